@@ -0,0 +1,321 @@
+// Distances.c ... all-pairs distance tables
+//
+// One table per rail phase (hunters) or for Dracula, and per transport
+// mask. Each table holds, for every pair of places, the fewest turns
+// between them and the move to make this turn to get there that fast.
+// A table is built the first time it is used (or by buildDistances())
+// with one breadth first search per starting place.
+//
+// hunterRoute() answers a single question without a table, searching
+// from both ends at once over (place, rail phase) states.
+
+#include <assert.h>
+#include <string.h>
+#include "Distances.h"
+#include "Map.h"
+#include "LocSet.h"
+#include "Trace.h"
+
+#define NUM_RULES       5    // the four hunter rail phases, then Dracula
+#define DRACULA_RULES   4
+#define NUM_MASKS       (BY_ANY + 1)
+#define UNREACHED       255
+
+static unsigned char distTable[NUM_RULES][NUM_MASKS][NUM_MAP_LOCATIONS][NUM_MAP_LOCATIONS];
+static unsigned char moveTable[NUM_RULES][NUM_MASKS][NUM_MAP_LOCATIONS][NUM_MAP_LOCATIONS];
+static int built[NUM_RULES][NUM_MASKS];
+
+// store in moves every place a player can get to in one turn from "from"
+//  (other than staying there), passing through at most "stations" rail stops
+// returns the number of places found
+static int oneTurnMoves(LocationID from, int stations, int dracula,
+                        int transport, LocationID moves[NUM_MAP_LOCATIONS])
+{
+    Map map = sharedMap(FULL_GRAPH);
+    LocSet seen = singletonSet(from);
+    LocSet onLine = singletonSet(from);
+    LocationID line[NUM_MAP_LOCATIONS];
+    int nMoves = 0, nLine = 0, first, last, i, depth;
+    EdgeIter it;
+    LocationID to;
+    TransportID type;
+
+    for (startEdges(map, from, &it); nextEdge(&it, &to, &type); ) {
+        if (inSet(seen, to)) continue;
+        if ((type == ROAD && (transport & BY_ROAD)) ||
+            (type == BOAT && (transport & BY_SEA))) {
+            // Dracula can't go to the hospital
+            if (dracula && to == ST_JOSEPH_AND_ST_MARYS) continue;
+            addToSet(&seen, to);
+            moves[nMoves++] = to;
+        }
+    }
+    if (dracula || !(transport & BY_RAIL)) return nMoves;
+
+    // follow the rail lines breadth first, one stop per level
+    line[nLine++] = from;
+    first = 0;
+    for (depth = 0; depth < stations; depth++) {
+        last = nLine;
+        for (i = first; i < last; i++) {
+            for (startEdges(map, line[i], &it); nextEdge(&it, &to, &type); ) {
+                if (type != RAIL || inSet(onLine, to)) continue;
+                addToSet(&onLine, to);
+                line[nLine++] = to;
+                if (!inSet(seen, to)) {
+                    addToSet(&seen, to);
+                    moves[nMoves++] = to;
+                }
+            }
+        }
+        first = last;
+    }
+    return nMoves;
+}
+
+// fill in the row of a table for one starting place
+// every place already reached is expanded again whenever the rail phase
+//  lets it go further than before, since the player can rest and wait
+static void buildFrom(int rules, int transport, LocationID src)
+{
+    unsigned char *dist = distTable[rules][transport][src];
+    unsigned char *move = moveTable[rules][transport][src];
+    LocationID reached[NUM_MAP_LOCATIONS], moves[NUM_MAP_LOCATIONS];
+    LocationID parent[NUM_MAP_LOCATIONS];
+    int expandedWith[NUM_MAP_LOCATIONS];
+    int nReached = 0, nMoves, oldReached, stations, turn, idle, i, j;
+    LocationID u, v;
+
+    memset(dist, UNREACHED, NUM_MAP_LOCATIONS);
+    memset(move, UNREACHED, NUM_MAP_LOCATIONS);
+    for (i = 0; i < NUM_MAP_LOCATIONS; i++) expandedWith[i] = -1;
+    dist[src] = 0;
+    move[src] = src;
+    parent[src] = src;
+    reached[nReached++] = src;
+
+    // stop once every place is reached, or nothing new turned up
+    //  in a whole cycle of rail phases
+    for (turn = 0, idle = 0; nReached < NUM_MAP_LOCATIONS && idle < 4; turn++) {
+        stations = (rules == DRACULA_RULES) ? 0 : (rules + turn) % 4;
+        oldReached = nReached;
+        for (i = 0; i < oldReached; i++) {
+            u = reached[i];
+            if (stations <= expandedWith[u]) continue;
+            expandedWith[u] = stations;
+            nMoves = oneTurnMoves(u, stations, rules == DRACULA_RULES,
+                                  transport, moves);
+            for (j = 0; j < nMoves; j++) {
+                v = moves[j];
+                if (dist[v] != UNREACHED) continue;
+                dist[v] = turn + 1;
+                parent[v] = u;
+                reached[nReached++] = v;
+            }
+        }
+        idle = (nReached == oldReached) ? idle + 1 : 0;
+    }
+
+    // the first move towards v is the first step of its search path,
+    //  or staying put if that step had to wait for a later turn
+    for (i = 1; i < nReached; i++) {
+        v = reached[i];
+        if (parent[v] != src) move[v] = move[parent[v]];
+        else if (dist[v] > 1) move[v] = src;
+        else move[v] = v;
+    }
+}
+
+// make sure the table for the given rules and transport exists
+static void needTable(int rules, int transport)
+{
+    LocationID src;
+    if (built[rules][transport]) return;
+    for (src = 0; src < NUM_MAP_LOCATIONS; src++) {
+        buildFrom(rules, transport, src);
+    }
+    built[rules][transport] = 1;
+}
+
+// which table answers a question about player moving first in round
+static int rulesFor(PlayerID player, Round round)
+{
+    assert(player >= PLAYER_LORD_GODALMING && player < NUM_PLAYERS);
+    assert(round >= 0);
+    if (player == PLAYER_DRACULA) return DRACULA_RULES;
+    return (round + player) % 4;
+}
+
+int shortestDistance(LocationID src, LocationID dest, PlayerID player,
+                     Round round, int transport)
+{
+    int rules = rulesFor(player, round);
+    assert(validPlace(src) && validPlace(dest));
+    assert(transport > 0 && transport < NUM_MASKS);
+    needTable(rules, transport);
+    if (distTable[rules][transport][src][dest] == UNREACHED) return NO_PATH;
+    return distTable[rules][transport][src][dest];
+}
+
+LocationID shortestNextMove(LocationID src, LocationID dest, PlayerID player,
+                            Round round, int transport)
+{
+    int rules = rulesFor(player, round);
+    assert(validPlace(src) && validPlace(dest));
+    assert(transport > 0 && transport < NUM_MASKS);
+    needTable(rules, transport);
+    if (moveTable[rules][transport][src][dest] == UNREACHED) return NOWHERE;
+    return moveTable[rules][transport][src][dest];
+}
+
+int shortestPath(LocationID src, LocationID dest, PlayerID player,
+                 Round round, int transport, LocationID *path)
+{
+    int length = shortestDistance(src, dest, player, round, transport);
+    int i;
+    path[0] = src;
+    for (i = 0; i < length; i++) {
+        path[i + 1] = shortestNextMove(path[i], dest, player, round + i, transport);
+    }
+    return length;
+}
+
+void buildDistances(void)
+{
+    int rules, transport;
+    for (rules = 0; rules < NUM_RULES; rules++) {
+        for (transport = 1; transport < NUM_MASKS; transport++) {
+            needTable(rules, transport);
+        }
+    }
+}
+
+// places a hunter can be at after one turn from "from" (staying put
+//  included) when the turn allows the given number of rail stops
+// (movesFromSet() works the stops out from player + round, so
+//  player 0 in round "stations" gets exactly that many)
+static LocSet stepSet(LocationID from, int stations, int transport)
+{
+    return movesFromSet(from, PLAYER_LORD_GODALMING, stations,
+                        transport & BY_ROAD, transport & BY_RAIL, transport & BY_SEA);
+}
+
+// the best meeting place found so far, given the places in meet
+//  (all at rail phase "phase") where the two searches have touched
+static void bestMeeting(LocSet meet, int phase, int fDepth[4][NUM_MAP_LOCATIONS],
+                        int bDepth[4][NUM_MAP_LOCATIONS],
+                        LocationID *at, int *atPhase, int *length)
+{
+    LocationID x;
+    while ((x = popFromSet(&meet)) != NOWHERE) {
+        if (*length == NO_PATH || fDepth[phase][x] + bDepth[phase][x] < *length) {
+            *length = fDepth[phase][x] + bDepth[phase][x];
+            *at = x;
+            *atPhase = phase;
+        }
+    }
+}
+
+// A state is a place and the number of rail stops the next turn allows.
+// The forward search starts from src at the player's phase, so all of one
+// of its levels share a phase; the backward search starts from dest at
+// every phase, since any arrival turn will do. Whichever frontier is
+// smaller is grown by a whole level, and the first level on which the two
+// touch holds a shortest route.
+int hunterRoute(LocationID src, LocationID dest, PlayerID player,
+                Round round, int transport, LocationID *path)
+{
+    TRACE_SCOPE(TRACE_HUNTER_ROUTE);
+    LocSet fSeen[4], bSeen[4], bFrontier[4], bNext[4], fFrontier, fNext, step;
+    LocationID fParent[4][NUM_MAP_LOCATIONS], bChild[4][NUM_MAP_LOCATIONS];
+    int fDepth[4][NUM_MAP_LOCATIONS], bDepth[4][NUM_MAP_LOCATIONS];
+    int fPhase, depth = 0, bLevel = 0, length = NO_PATH;
+    int phase, prev, fSize, bSize, i, n;
+    LocationID u, v, at = NOWHERE;
+    LocSet left;
+
+    assert(validPlace(src) && validPlace(dest));
+    assert(player >= PLAYER_LORD_GODALMING && player < PLAYER_DRACULA);
+    assert(round >= 0);
+    assert(transport > 0 && transport < NUM_MASKS);
+
+    path[0] = src;
+    if (src == dest) return 0;
+
+    fPhase = (round + player) % 4;
+    for (phase = 0; phase < 4; phase++) {
+        fSeen[phase] = bSeen[phase] = emptySet();
+        bFrontier[phase] = singletonSet(dest);
+        addToSet(&bSeen[phase], dest);
+        bDepth[phase][dest] = 0;
+        bChild[phase][dest] = dest;
+    }
+    fFrontier = singletonSet(src);
+    addToSet(&fSeen[fPhase], src);
+    fDepth[fPhase][src] = 0;
+    fParent[fPhase][src] = src;
+    bestMeeting(setIntersect(fFrontier, bSeen[fPhase]), fPhase, fDepth, bDepth,
+                &at, &phase, &length);
+
+    while (length == NO_PATH) {
+        fSize = setSize(fFrontier);
+        for (bSize = 0, i = 0; i < 4; i++) bSize += setSize(bFrontier[i]);
+        if (fSize == 0 || bSize == 0) return NO_PATH;
+
+        if (fSize <= bSize) {
+            // one more turn forwards
+            n = (fPhase + 1) % 4;
+            fNext = emptySet();
+            for (left = fFrontier; (u = popFromSet(&left)) != NOWHERE; ) {
+                step = setMinus(stepSet(u, fPhase, transport), fSeen[n]);
+                fNext = setUnion(fNext, step);
+                fSeen[n] = setUnion(fSeen[n], step);
+                while ((v = popFromSet(&step)) != NOWHERE) {
+                    fParent[n][v] = u;
+                    fDepth[n][v] = depth + 1;
+                }
+            }
+            fFrontier = fNext;
+            fPhase = n;
+            depth++;
+            bestMeeting(setIntersect(fFrontier, bSeen[fPhase]), fPhase, fDepth, bDepth,
+                        &at, &phase, &length);
+        } else {
+            // one more turn backwards: u comes before v if v is one turn from u
+            //  (rail, road and sea all go both ways)
+            for (i = 0; i < 4; i++) bNext[i] = emptySet();
+            for (i = 0; i < 4; i++) {
+                prev = (i + 3) % 4;
+                for (left = bFrontier[i]; (v = popFromSet(&left)) != NOWHERE; ) {
+                    step = setMinus(stepSet(v, prev, transport), bSeen[prev]);
+                    bNext[prev] = setUnion(bNext[prev], step);
+                    bSeen[prev] = setUnion(bSeen[prev], step);
+                    while ((u = popFromSet(&step)) != NOWHERE) {
+                        bChild[prev][u] = v;
+                        bDepth[prev][u] = bLevel + 1;
+                    }
+                }
+            }
+            bLevel++;
+            for (i = 0; i < 4; i++) {
+                bFrontier[i] = bNext[i];
+                bestMeeting(setIntersect(bFrontier[i], fSeen[i]), i, fDepth, bDepth,
+                            &at, &phase, &length);
+            }
+        }
+    }
+
+    // back from the meeting place to src, then on from it to dest
+    n = fDepth[phase][at];
+    for (u = at, i = n, prev = phase; i > 0; i--) {
+        path[i] = u;
+        u = fParent[prev][u];
+        prev = (prev + 3) % 4;
+    }
+    for (u = at, i = n, prev = phase; i < length; i++) {
+        u = bChild[prev][u];
+        prev = (prev + 1) % 4;
+        path[i + 1] = u;
+    }
+    return length;
+}
@@ -0,0 +1,51 @@
+// Distances.h ... interface to the all-pairs distance tables
+//
+// The map never changes and how far a hunter can go by rail only depends
+// on (round + player) % 4, so the fewest number of turns between any two
+// places can be worked out once for every rail phase and transport mask
+// and then looked up instead of searched for on every query.
+
+#ifndef DISTANCES_H
+#define DISTANCES_H
+
+#include "Globals.h"
+#include "Places.h"
+
+// transport masks, OR them together to allow several kinds of transport
+#define BY_ROAD      1
+#define BY_RAIL      2
+#define BY_SEA       4
+#define BY_ANY       (BY_ROAD | BY_RAIL | BY_SEA)
+
+// returned by shortestDistance() if dest can't be reached at all
+#define NO_PATH      -1
+
+// fewest turns for player to get from src to dest when the first move
+//  is made in the given round, using only the transport in the mask
+// a player can always rest, so waiting for a better rail turn is allowed
+// Dracula never takes the train and never enters the hospital
+int shortestDistance(LocationID src, LocationID dest, PlayerID player,
+                     Round round, int transport);
+
+// where player should move this turn (possibly staying at src)
+//  to get to dest in shortestDistance() turns
+LocationID shortestNextMove(LocationID src, LocationID dest, PlayerID player,
+                            Round round, int transport);
+
+// fill path[0] with src and path[1..n] with the location player is at
+//  after each turn of a shortest route to dest, and return n
+// path must have room for NUM_MAP_LOCATIONS entries
+int shortestPath(LocationID src, LocationID dest, PlayerID player,
+                 Round round, int transport, LocationID *path);
+
+// the same as shortestPath() for a hunter (the route may differ but not
+//  its length), worked out for just this question by searching from both
+//  ends at once instead of building a whole table
+// quicker when only a few routes are wanted, as when a hunter decides a move
+int hunterRoute(LocationID src, LocationID dest, PlayerID player,
+                Round round, int transport, LocationID *path);
+
+// build every table now rather than the first time each one is used
+void buildDistances(void);
+
+#endif
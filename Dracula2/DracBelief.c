@@ -0,0 +1,205 @@
+// DracBelief.c ... a probability for each place Dracula could be at
+//
+// Dracula's moves are kept as a compressed sparse row table: the places
+// he can go to from "from" (by road or sea, never the hospital) are
+// moveTo[rowStart[from]] ... moveTo[rowStart[from + 1] - 1].
+
+#include <assert.h>
+#include <string.h>
+#include "DracBelief.h"
+#include "LocSet.h"
+#include "commonFunctions.h"
+
+#define MAX_MOVES      (NUM_MAP_LOCATIONS * NUM_MAP_LOCATIONS)
+
+static int rowStart[NUM_MAP_LOCATIONS + 1];
+static unsigned char moveTo[MAX_MOVES];
+static int tableBuilt = 0;
+
+static void buildMoveTable(void)
+{
+    LocationID from, to;
+    LocSet moves;
+    int n = 0;
+
+    for (from = MIN_MAP_LOCATION; from <= MAX_MAP_LOCATION; from++) {
+        rowStart[from] = n;
+        moves = setUnion(neighbourSet(from, ROAD), neighbourSet(from, BOAT));
+        removeFromSet(&moves, ST_JOSEPH_AND_ST_MARYS);
+        while ((to = popFromSet(&moves)) != NOWHERE) moveTo[n++] = to;
+    }
+    rowStart[NUM_MAP_LOCATIONS] = n;
+    tableBuilt = 1;
+}
+
+// chance spread evenly over every place Dracula could move to from where
+//  he might be now, stored in next
+static void spread(double chance[NUM_MAP_LOCATIONS], double next[NUM_MAP_LOCATIONS])
+{
+    LocationID from;
+    double share;
+    int i;
+
+    if (!tableBuilt) buildMoveTable();
+    memset(next, 0, NUM_MAP_LOCATIONS * sizeof(double));
+    for (from = MIN_MAP_LOCATION; from <= MAX_MAP_LOCATION; from++) {
+        if (chance[from] == 0 || rowStart[from + 1] == rowStart[from]) continue;
+        share = chance[from] / (rowStart[from + 1] - rowStart[from]);
+        for (i = rowStart[from]; i < rowStart[from + 1]; i++) {
+            next[moveTo[i]] += share;
+        }
+    }
+}
+
+// can Dracula be at place after a move the hunters saw as move
+static int fits(LocationID place, LocationID move)
+{
+    if (place == ST_JOSEPH_AND_ST_MARYS) return 0;
+    if (move == CITY_UNKNOWN) return isLand(place);
+    if (move == SEA_UNKNOWN) return isSea(place);
+    return 1;
+}
+
+// make the chances add up to one
+// if nothing is left (the even-choice guess went wrong) start again from
+//  every place that fits the move
+static void normalise(DracBelief *belief, LocationID move)
+{
+    LocationID p;
+    double total = 0;
+
+    for (p = MIN_MAP_LOCATION; p <= MAX_MAP_LOCATION; p++) total += belief->chance[p];
+    if (total == 0) {
+        for (p = MIN_MAP_LOCATION; p <= MAX_MAP_LOCATION; p++) {
+            belief->chance[p] = fits(p, move);
+            total += belief->chance[p];
+        }
+    }
+    for (p = MIN_MAP_LOCATION; p <= MAX_MAP_LOCATION; p++) belief->chance[p] /= total;
+}
+
+void startBelief(DracBelief *belief)
+{
+    int i;
+
+    memset(belief, 0, sizeof(DracBelief));
+    for (i = 0; i < TRAIL_SIZE; i++) belief->trail[i] = UNKNOWN_LOCATION;
+    for (i = 0; i < NUM_PLAYERS - 1; i++) belief->hunters[i] = UNKNOWN_LOCATION;
+    normalise(belief, UNKNOWN_LOCATION);
+}
+
+void beliefDraculaMove(DracBelief *belief, LocationID move)
+{
+    double next[NUM_MAP_LOCATIONS];
+    LocationID p;
+    int i, back;
+
+    if (validPlace(move) || move == TELEPORT) {
+        memset(next, 0, sizeof(next));
+        next[(move == TELEPORT) ? CASTLE_DRACULA : move] = 1;
+    } else if (move == HIDE) {
+        memcpy(next, belief->chance, sizeof(next));
+        for (p = MIN_MAP_LOCATION; p <= MAX_MAP_LOCATION; p++) {
+            if (isSea(p)) next[p] = 0;
+        }
+    } else if (move >= DOUBLE_BACK_1 && move <= DOUBLE_BACK_5) {
+        back = move - DOUBLE_BACK_1;
+        memcpy(next, (back < belief->nMoves) ? belief->past[back] : belief->chance, sizeof(next));
+    } else {
+        if (belief->nMoves == 0) {
+            memcpy(next, belief->chance, sizeof(next));
+        } else {
+            spread(belief->chance, next);
+        }
+        // not back to a place in the trail, and not onto a hunter
+        //  (he would have been seen)
+        for (i = 0; i < TRAIL_SIZE - 1; i++) {
+            if (validPlace(belief->trail[i])) next[belief->trail[i]] = 0;
+        }
+        for (i = 0; i < NUM_PLAYERS - 1; i++) {
+            if (validPlace(belief->hunters[i])) next[belief->hunters[i]] = 0;
+        }
+        for (p = MIN_MAP_LOCATION; p <= MAX_MAP_LOCATION; p++) {
+            if (!fits(p, move)) next[p] = 0;
+        }
+    }
+    memcpy(belief->chance, next, sizeof(next));
+    normalise(belief, move);
+
+    for (i = TRAIL_SIZE - 1; i > 0; i--) {
+        memcpy(belief->past[i], belief->past[i - 1], sizeof(belief->past[i]));
+        belief->trail[i] = belief->trail[i - 1];
+    }
+    memcpy(belief->past[0], belief->chance, sizeof(belief->past[0]));
+    belief->trail[0] = move;
+    belief->nMoves++;
+}
+
+void beliefHunterMove(DracBelief *belief, PlayerID hunter,
+                      LocationID where, int metDracula)
+{
+    assert(hunter >= PLAYER_LORD_GODALMING && hunter < PLAYER_DRACULA);
+    belief->hunters[hunter] = where;
+    if (!validPlace(where) || belief->nMoves == 0) return;
+
+    if (metDracula) {
+        memset(belief->chance, 0, sizeof(belief->chance));
+        belief->chance[where] = 1;
+    } else {
+        belief->chance[where] = 0;
+        normalise(belief, belief->trail[0]);
+    }
+    memcpy(belief->past[0], belief->chance, sizeof(belief->past[0]));
+}
+
+void beliefAddPlays(DracBelief *belief, char *plays, PlayerID player)
+{
+    char abbrev[3];
+    char *play;
+    int i, met;
+
+    assert(plays != NULL);
+    for (play = plays; play[0] == ' '; play++);
+    for (; play[0] != '\0' && play[1] != '\0' && play[2] != '\0'; ) {
+        strToAbbrev(play, abbrev);
+        if (player == PLAYER_DRACULA) {
+            beliefDraculaMove(belief, otherToID(abbrev));
+        } else {
+            met = 0;
+            for (i = 0; i < NUM_EVENT_ENCOUNTER && play[3 + i] != '\0'; i++) {
+                if (play[3 + i] == 'D') met = 1;
+            }
+            beliefHunterMove(belief, player, abbrevToID(abbrev), met);
+        }
+        player = (player + 1) % NUM_PLAYERS;
+
+        // on to the next play, past the space between them
+        for (i = 0; i < CHARS_PER_TURN - 1 && play[0] != '\0'; i++) play++;
+        if (play[0] == ' ') play++;
+    }
+}
+
+void beliefFromPlays(DracBelief *belief, char *pastPlays)
+{
+    startBelief(belief);
+    beliefAddPlays(belief, pastPlays, PLAYER_LORD_GODALMING);
+}
+
+int likeliestPlaces(DracBelief *belief, LocationID *places, int max)
+{
+    LocSet taken = emptySet();
+    LocationID p, best;
+    int n;
+
+    for (n = 0; n < max; n++) {
+        best = NOWHERE;
+        for (p = MIN_MAP_LOCATION; p <= MAX_MAP_LOCATION; p++) {
+            if (inSet(taken, p) || belief->chance[p] == 0) continue;
+            if (best == NOWHERE || belief->chance[p] > belief->chance[best]) best = p;
+        }
+        if (best == NOWHERE) break;
+        addToSet(&taken, best);
+        places[n] = best;
+    }
+    return n;
+}
@@ -0,0 +1,50 @@
+// DracBelief.h ... how likely Dracula is to be at each place, for hunters
+//
+// The hunters mostly see C? and S? for Dracula's moves. A DracBelief
+// keeps a probability for every place and is moved on one play at a time:
+// each of Dracula's moves spreads it over the places he could have gone
+// to (assuming he picks among them evenly) and what is seen of the move
+// (land or sea, a hide, a double back, a place revealed) rules the rest
+// out, and each hunter's move rules out where that hunter is unless they
+// met him there. The spreading is a sparse matrix-vector product over
+// a table of Dracula's moves built once, so a whole game costs a few
+// hundred thousand multiplications.
+
+#ifndef DRACBELIEF_H
+#define DRACBELIEF_H
+
+#include "Globals.h"
+#include "Places.h"
+
+typedef struct dracBelief {
+    double chance[NUM_MAP_LOCATIONS];              // of Dracula being at each place now
+    double past[TRAIL_SIZE][NUM_MAP_LOCATIONS];    // chance after each of his moves in the trail
+    LocationID trail[TRAIL_SIZE];                  // his moves as the hunters saw them
+    LocationID hunters[NUM_PLAYERS - 1];           // where each hunter is
+    int nMoves;                                    // moves Dracula has made
+} DracBelief;
+
+// before Dracula's first move: he could be anywhere but the hospital
+void startBelief(DracBelief *belief);
+
+// Dracula's move as the hunters see it: a place, CITY_UNKNOWN,
+//  SEA_UNKNOWN, HIDE, DOUBLE_BACK_1 ... DOUBLE_BACK_5 or TELEPORT
+void beliefDraculaMove(DracBelief *belief, LocationID move);
+
+// a hunter's move to where, and whether they met Dracula there
+void beliefHunterMove(DracBelief *belief, PlayerID hunter,
+                      LocationID where, int metDracula);
+
+// move a belief on by every play in a string of plays, the first of
+//  them made by player
+void beliefAddPlays(DracBelief *belief, char *plays, PlayerID player);
+
+// start a belief and move it on by every play in a past plays string
+void beliefFromPlays(DracBelief *belief, char *pastPlays);
+
+// the places Dracula is most likely to be at, most likely first, stored
+//  in places (at most max of them, only those with some chance at all)
+// returns how many were stored
+int likeliestPlaces(DracBelief *belief, LocationID *places, int max);
+
+#endif
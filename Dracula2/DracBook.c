@@ -0,0 +1,125 @@
+// DracBook.c ... looking things up in a mapped endgame table
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "DracBook.h"
+#include "LocSet.h"
+
+// FNV-1a, one value at a time
+#define FNV_START  2166136261u
+#define FNV_PRIME  16777619u
+
+struct dracBook {
+    const unsigned char *base;
+    const unsigned char *endgame;
+};
+
+static unsigned int hashValue(unsigned int hash, unsigned int value)
+{
+    int i;
+
+    for (i = 0; i < 4; i++, value >>= 8) hash = (hash ^ (value & 0xff)) * FNV_PRIME;
+    return hash;
+}
+
+static unsigned int bookKey(void)
+{
+    unsigned int hash = hashValue(FNV_START, ENDGAME_TURNS);
+    LocSet left;
+    LocationID d, p;
+
+    hash = hashValue(hash, NUM_MAP_LOCATIONS);
+    for (d = MIN_MAP_LOCATION; d <= MAX_MAP_LOCATION; d++) {
+        hash = hashValue(hash, isLand(d));
+        for (left = neighbourSet(d, ROAD); (p = popFromSet(&left)) != NOWHERE; ) {
+            hash = hashValue(hash, p);
+        }
+        hash = hashValue(hash, NOWHERE);
+        for (left = neighbourSet(d, BOAT); (p = popFromSet(&left)) != NOWHERE; ) {
+            hash = hashValue(hash, p);
+        }
+        hash = hashValue(hash, NOWHERE);
+    }
+    return hash;
+}
+
+void bookKeyBytes(unsigned char bytes[BOOK_KEY_BYTES])
+{
+    unsigned int key = bookKey();
+    int i;
+
+    for (i = 0; i < BOOK_KEY_BYTES; i++, key >>= 8) bytes[i] = key & 0xff;
+}
+
+void bookPath(char *path, int size)
+{
+    char *env = getenv(BOOK_PATH_ENV);
+    char *slash;
+    ssize_t n;
+
+    if (env != NULL && env[0] != '\0') {
+        snprintf(path, size, "%s", env);
+        return;
+    }
+    n = readlink("/proc/self/exe", path, size - 1);
+    if (n > 0) {
+        path[n] = '\0';
+        slash = strrchr(path, '/');
+        if (slash != NULL && (slash - path) + 1 + strlen(BOOK_FILE) < (size_t)size) {
+            strcpy(slash + 1, BOOK_FILE);
+            return;
+        }
+    }
+    snprintf(path, size, "%s", BOOK_FILE);
+}
+
+DracBook openDracBook(char *path)
+{
+    unsigned char key[BOOK_KEY_BYTES];
+    DracBook book;
+    struct stat info;
+    void *base;
+    int fd = open(path, O_RDONLY);
+
+    if (fd < 0) return NULL;
+    if (fstat(fd, &info) < 0 || info.st_size != BOOK_SIZE) {
+        close(fd);
+        return NULL;
+    }
+    base = mmap(NULL, BOOK_SIZE, PROT_READ, MAP_PRIVATE, fd, 0);
+    // the mapping stays after the file is closed
+    close(fd);
+    if (base == MAP_FAILED) return NULL;
+    bookKeyBytes(key);
+    if (memcmp(base, BOOK_HEADER, BOOK_HEADER_BYTES) != 0 ||
+        memcmp((unsigned char *)base + BOOK_HEADER_BYTES, key, BOOK_KEY_BYTES) != 0) {
+        munmap(base, BOOK_SIZE);
+        return NULL;
+    }
+    // lookups jump all over the file
+    madvise(base, BOOK_SIZE, MADV_RANDOM);
+
+    book = malloc(sizeof(struct dracBook));
+    assert(book != NULL);
+    book->base = base;
+    book->endgame = book->base + BOOK_HEADER_BYTES + BOOK_KEY_BYTES;
+    return book;
+}
+
+void closeDracBook(DracBook book)
+{
+    munmap((void *)book->base, BOOK_SIZE);
+    free(book);
+}
+
+int bookEndgame(DracBook book, LocationID d, LocationID a, LocationID b)
+{
+    assert(validPlace(d) && validPlace(a) && validPlace(b));
+    return book->endgame[(d * NUM_MAP_LOCATIONS + a) * NUM_MAP_LOCATIONS + b];
+}
@@ -0,0 +1,61 @@
+// DracBook.h ... Dracula's endgame table, worked out offline
+//
+// When Dracula is down to his last blood points and can only stay on
+// land, how many hunter turns he can keep away from the two nearest
+// hunters depends on nothing but where the three of them are, so mkbook
+// works it out ahead of time for every (Dracula, hunter, hunter) triple,
+// one byte each, by working back from the places where they catch him.
+// (Where he starts the game depends only on where the hunters are too,
+// but startLocation() works that out in no time, so it isn't kept.)
+//
+// The file is a four byte header ("DBK2", changed whenever the way the
+// table is worked out changes), a four byte key (see bookKeyBytes())
+// and then the table. The key is a hash of everything the table was
+// worked out from, so a book made for another map or another
+// ENDGAME_TURNS is turned down rather than trusted. The file is mapped
+// into memory when opened, so only the pages looked up are ever read
+// from the disk.
+
+#ifndef DRACBOOK_H
+#define DRACBOOK_H
+
+#include "Globals.h"
+#include "Places.h"
+
+#define BOOK_FILE          "dracBook.bin"
+#define BOOK_PATH_ENV      "DRAC_BOOK"    // where to find the book instead
+#define BOOK_HEADER        "DBK2"
+#define BOOK_HEADER_BYTES  4
+#define BOOK_KEY_BYTES     4
+
+// the endgame entry for Dracula at d and hunters at a and b (about to
+//  move) is at (d * 71 + a) * 71 + b
+#define BOOK_ENDGAME_SIZE  (NUM_MAP_LOCATIONS * NUM_MAP_LOCATIONS * NUM_MAP_LOCATIONS)
+#define BOOK_SIZE          (BOOK_HEADER_BYTES + BOOK_KEY_BYTES + BOOK_ENDGAME_SIZE)
+
+// the endgame table counts at most this many turns
+#define ENDGAME_TURNS      12
+
+typedef struct dracBook *DracBook;
+
+// the key for a book made now: a hash of the map (each place's land or
+//  sea, road and boat neighbours) and ENDGAME_TURNS, as stored in the file
+void bookKeyBytes(unsigned char bytes[BOOK_KEY_BYTES]);
+
+// where the AI looks for its book: $DRAC_BOOK if it is set, otherwise
+//  BOOK_FILE in the directory the running program is in (or the current
+//  directory if that can't be told)
+void bookPath(char *path, int size);
+
+// map a book file, or return NULL if it can't be opened, isn't one or
+//  was made for another map or version
+DracBook openDracBook(char *path);
+
+void closeDracBook(DracBook book);
+
+// how many turns the hunters at a and b, who are about to move, need to
+//  catch Dracula at d if he keeps to land (up to ENDGAME_TURNS)
+// 0 means one of them is there or next to him already
+int bookEndgame(DracBook book, LocationID d, LocationID a, LocationID b);
+
+#endif
@@ -0,0 +1,253 @@
+// DracReach.c ... searches over Dracula's (place, trail) states
+//
+// Only the last five moves of the trail limit Dracula's next move, so a
+// state is five slots of 9 bits. Two states that differ only in a trail
+// place Dracula can't get next to before it drops off the trail behave
+// the same from then on, so such places are cleared when a state is made
+// and far fewer distinct states are seen than there are trails.
+
+#include <assert.h>
+#include <string.h>
+#include "DracReach.h"
+#include "Distances.h"
+
+#define SLOT_BITS      9
+#define NUM_SLOTS      (TRAIL_SIZE - 1)
+#define STATE_MASK     ((1ULL << (SLOT_BITS * NUM_SLOTS)) - 1)
+#define NO_PLACE       127
+
+// the kind of move that put Dracula in a slot
+#define BY_PLACE       0
+#define BY_HIDE        1
+#define BY_DOUBLE_BACK 2
+
+#define SEEN_BITS      13
+#define SEEN_SIZE      (1 << SEEN_BITS)
+#define MAX_SEEN       (SEEN_SIZE / 2)    // states recorded by one search
+#define EMPTY_SLOT     (~0ULL)
+#define MOVES_SHIFT    56                 // seen states keep the moves taken up here
+
+#define DRAC_MOVES     (BY_ROAD | BY_SEA)
+
+// the fixed-size working space of one search, kept on the stack
+typedef struct search {
+    DracState seen[SEEN_SIZE];            // fewest moves each state was reached in
+    int nSeen;
+    LocationID dest;                      // NOWHERE when looking for every place
+    int hideAllow;
+    int bound;                            // most moves the search may take
+    int beyond;                           // least bound that would get further
+    LocationID first;                     // where the first move went
+    LocSet reached;
+} Search;
+
+static LocationID slotPlace(DracState state, int slot)
+{
+    return (state >> (SLOT_BITS * slot)) & NO_PLACE;
+}
+
+static int slotKind(DracState state, int slot)
+{
+    return (state >> (SLOT_BITS * slot + 7)) & 3;
+}
+
+static DracState push(DracState state, LocationID place, int kind)
+{
+    return ((state << SLOT_BITS) | place | (kind << 7)) & STATE_MASK;
+}
+
+// clear the trail places that can't matter any more: the place in slot i
+//  stays on the trail for 5 - i more moves, so it only matters while
+//  Dracula can still get next to it in that time
+static DracState canonical(DracState state)
+{
+    LocationID here = slotPlace(state, 0), place;
+    int slot, dist;
+
+    for (slot = 1; slot < NUM_SLOTS; slot++) {
+        place = slotPlace(state, slot);
+        if (place == NO_PLACE) continue;
+        dist = shortestDistance(here, place, PLAYER_DRACULA, 0, DRAC_MOVES);
+        if (dist == NO_PATH || dist > NUM_SLOTS - slot) {
+            state |= (DracState)NO_PLACE << (SLOT_BITS * slot);
+        }
+    }
+    return state;
+}
+
+DracState dracState(LocationID trail[TRAIL_SIZE], LocationID moves[TRAIL_SIZE])
+{
+    DracState state = 0;
+    int slot, kind;
+
+    for (slot = NUM_SLOTS - 1; slot >= 0; slot--) {
+        if (moves[slot] == HIDE) kind = BY_HIDE;
+        else if (moves[slot] >= DOUBLE_BACK_1 && moves[slot] <= DOUBLE_BACK_5) kind = BY_DOUBLE_BACK;
+        else kind = BY_PLACE;
+        state = push(state, validPlace(trail[slot]) ? trail[slot] : NO_PLACE, kind);
+    }
+    return canonical(state);
+}
+
+DracState dracMoveTo(DracState state, LocationID place)
+{
+    assert(validPlace(place));
+    return canonical(push(state, place, BY_PLACE));
+}
+
+LocationID dracStateLocation(DracState state)
+{
+    LocationID here = slotPlace(state, 0);
+    return (here == NO_PLACE) ? NOWHERE : here;
+}
+
+int dracNextStates(DracState state, int hideAllow,
+                   DracState next[NUM_MAP_LOCATIONS + TRAIL_SIZE])
+{
+    LocationID here = slotPlace(state, 0), place;
+    LocSet adjacent, onTrail = emptySet(), left;
+    int slot, hidden = 0, doubledBack = 0, n = 0;
+
+    if (here == NO_PLACE) return 0;
+    for (slot = 0; slot < NUM_SLOTS; slot++) {
+        place = slotPlace(state, slot);
+        if (place != NO_PLACE) addToSet(&onTrail, place);
+        if (slotKind(state, slot) == BY_HIDE) hidden = 1;
+        if (slotKind(state, slot) == BY_DOUBLE_BACK) doubledBack = 1;
+    }
+    adjacent = setUnion(neighbourSet(here, ROAD), neighbourSet(here, BOAT));
+    removeFromSet(&adjacent, ST_JOSEPH_AND_ST_MARYS);
+
+    left = setMinus(adjacent, onTrail);
+    while ((place = popFromSet(&left)) != NOWHERE) {
+        next[n++] = canonical(push(state, place, BY_PLACE));
+    }
+    if (!hideAllow) return n;
+
+    if (!hidden && !isSea(here)) {
+        next[n++] = canonical(push(state, here, BY_HIDE));
+    }
+    if (!doubledBack) {
+        for (slot = 0; slot < NUM_SLOTS; slot++) {
+            place = slotPlace(state, slot);
+            if (place == NO_PLACE) continue;
+            if (place != here && !inSet(adjacent, place)) continue;
+            next[n++] = canonical(push(state, place, BY_DOUBLE_BACK));
+        }
+    }
+    return n;
+}
+
+static void startSearch(Search *s, int bound)
+{
+    memset(s->seen, 0xff, sizeof(s->seen));
+    s->nSeen = 0;
+    s->bound = bound;
+    s->beyond = NUM_MAP_LOCATIONS;
+}
+
+// note that state was reached in the given number of moves, returning 0
+//  if it has been reached in as few before (and so needn't be searched again)
+// once the set is full states are searched again whenever they are reached
+static int markSeen(Search *s, DracState state, int moves)
+{
+    unsigned i = (state * 0x9E3779B97F4A7C15ULL) >> (64 - SEEN_BITS);
+    DracState entry = state | ((DracState)moves << MOVES_SHIFT);
+
+    while (s->seen[i] != EMPTY_SLOT) {
+        if ((s->seen[i] & STATE_MASK) == state) {
+            if ((int)(s->seen[i] >> MOVES_SHIFT) <= moves) return 0;
+            s->seen[i] = entry;
+            return 1;
+        }
+        i = (i + 1) & (SEEN_SIZE - 1);
+    }
+    if (s->nSeen < MAX_SEEN) {
+        s->seen[i] = entry;
+        s->nSeen++;
+    }
+    return 1;
+}
+
+// depth first from a state reached in the given number of moves, never
+//  going past the bound, and returning 1 once dest is found
+// the fewest moves still needed without the trail rules prunes the search
+//  for dest, so only routes that could be short enough are followed
+static int visit(Search *s, DracState state, int moves)
+{
+    DracState next[NUM_MAP_LOCATIONS + TRAIL_SIZE];
+    int nNext, i, left;
+    LocationID place;
+
+    if (!markSeen(s, state, moves)) return 0;
+    nNext = dracNextStates(state, s->hideAllow, next);
+    for (i = 0; i < nNext; i++) {
+        place = slotPlace(next[i], 0);
+        if (s->dest == NOWHERE) {
+            addToSet(&s->reached, place);
+            if (moves + 1 < s->bound) visit(s, next[i], moves + 1);
+            continue;
+        }
+        if (place == s->dest) {
+            if (moves == 0) s->first = place;
+            return 1;
+        }
+        left = shortestDistance(place, s->dest, PLAYER_DRACULA, 0, DRAC_MOVES);
+        if (left == NO_PATH) continue;
+        if (moves + 1 + left > s->bound) {
+            if (moves + 1 + left < s->beyond) s->beyond = moves + 1 + left;
+            continue;
+        }
+        if (visit(s, next[i], moves + 1)) {
+            if (moves == 0) s->first = place;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// searched again with a bigger bound each time until dest is found, so
+//  the first route found is a shortest one
+int dracDistance(DracState state, LocationID dest, int hideAllow,
+                 LocationID *firstStep)
+{
+    Search s;
+    LocationID here = slotPlace(state, 0);
+    int bound;
+
+    assert(validPlace(dest));
+    if (here == dest) {
+        if (firstStep != NULL) *firstStep = dest;
+        return 0;
+    }
+    if (here == NO_PLACE) return NO_PATH;
+    bound = shortestDistance(here, dest, PLAYER_DRACULA, 0, DRAC_MOVES);
+    if (bound == NO_PATH) return NO_PATH;
+
+    s.dest = dest;
+    s.hideAllow = hideAllow;
+    while (bound < NUM_MAP_LOCATIONS) {
+        startSearch(&s, bound);
+        if (visit(&s, state, 0)) {
+            if (firstStep != NULL) *firstStep = s.first;
+            return bound;
+        }
+        bound = s.beyond;
+    }
+    return NO_PATH;
+}
+
+LocSet dracReachable(DracState state, int k, int hideAllow)
+{
+    Search s;
+
+    s.reached = emptySet();
+    if (slotPlace(state, 0) == NO_PLACE) return s.reached;
+    addToSet(&s.reached, slotPlace(state, 0));
+    if (k <= 0) return s.reached;
+    s.dest = NOWHERE;
+    s.hideAllow = hideAllow;
+    startSearch(&s, k);
+    visit(&s, state, 0);
+    return s.reached;
+}
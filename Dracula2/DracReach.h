@@ -0,0 +1,48 @@
+// DracReach.h ... where Dracula can get to under the trail rules
+//
+// Dracula can't move to a place in the last five moves of his trail,
+// can only hide or double back once each in it, and can't hide at sea,
+// so how far away a place is for him depends on the trail as well as on
+// the map. A DracState packs where he is and what the rules still care
+// about in his trail into one 64-bit integer, and the searches here go
+// over those states with a fixed-size hash set of the ones already seen,
+// so they allocate nothing while they run.
+
+#ifndef DRACREACH_H
+#define DRACREACH_H
+
+#include "Globals.h"
+#include "Places.h"
+#include "LocSet.h"
+
+// slot i (0 is the move he just made) holds a place in its low 7 bits and
+//  the kind of move that took him there in the next 2
+typedef unsigned long long DracState;
+
+// pack Dracula's trail, most recent first, with the moves that made it
+//  (places, HIDE, DOUBLE_BACK_1 ... or TELEPORT), as DracView gives them
+DracState dracState(LocationID trail[TRAIL_SIZE], LocationID moves[TRAIL_SIZE]);
+
+// the state after Dracula moves to place by an ordinary move
+DracState dracMoveTo(DracState state, LocationID place);
+
+// where Dracula is in a state
+LocationID dracStateLocation(DracState state);
+
+// every state Dracula can go to with his next move, returning how many
+// with hideAllow 0 only moves to places off the trail are tried,
+//  otherwise hiding and doubling back are too
+int dracNextStates(DracState state, int hideAllow,
+                   DracState next[NUM_MAP_LOCATIONS + TRAIL_SIZE]);
+
+// fewest moves for Dracula to get to dest, or NO_PATH if he can't
+//  (or the search runs out of room, which doesn't happen on this map)
+// if firstStep isn't NULL it is set to where his first move takes him
+int dracDistance(DracState state, LocationID dest, int hideAllow,
+                 LocationID *firstStep);
+
+// every place Dracula can be at after at most k moves (where he is now
+//  included)
+LocSet dracReachable(DracState state, int k, int hideAllow);
+
+#endif
@@ -1,6 +1,7 @@
 // DracView.c ... DracView ADT implementation
 
 #include <stdlib.h>
+#include <string.h>
 #include <assert.h>
 #include "Globals.h"
 #include "Game.h"
@@ -9,50 +10,66 @@
 #include "commonFunctions.h"
 
 typedef struct _encounterData {
-    LocationID location;    // location ID of the trails
+    int trailPos;           // newest place in Dracula's trail it is at, or -1
+    LocationID move;        // the move made there (the place, HIDE or DOUBLE_BACK_n)
     int numTraps;           // number of traps in the location
     int numVamps;           // number of vampires in the location
 } encounterData;
 
 struct dracView {
     GameView view;
-    encounterData *trail[TRAIL_SIZE];    // encounter detail in Dracula's trail
+    encounterData places[NUM_MAP_LOCATIONS];    // encounter detail for every place
+    int specialMoves;       // hasDBOrHI() of Dracula's trail
+    int dbPos;              // posOfDb() of Dracula's trail
 };
 
-// Creates a new DracView to summarise the current state of the game
-DracView newDracView(char *pastPlays, PlayerMessage messages[]) {
+// Fills in the encounter table from the plays the GameView has read
+static void updateTrail(DracView dracView) {
     int i;
+    LocationID where;
     LocationID trail[TRAIL_SIZE];
+    LocationID hideTrail[TRAIL_SIZE];
+    encounterData *place;
 
-    DracView dracView = malloc(sizeof(struct dracView));
-    assert(dracView != NULL);
-    dracView->view = newGameView(pastPlays, messages);
-    dracView->view->players[PLAYER_DRACULA]->playerCurrLocation =
-        whereIs(dracView, PLAYER_DRACULA);
-
-    for (i = 0; i < TRAIL_SIZE ; i++) {
-        dracView->trail[i] = malloc(sizeof(encounterData));
-        assert(dracView->trail[i] != NULL);
+    for (where = MIN_MAP_LOCATION; where <= MAX_MAP_LOCATION; where++) {
+        place = &dracView->places[where];
+        place->trailPos = -1;
+        place->move = NOWHERE;
+        getMinions(dracView->view, where, &place->numTraps, &place->numVamps);
     }
     giveMeTheTrail(dracView, PLAYER_DRACULA, trail, FALSE);
-    for (i = 0; i < TRAIL_SIZE ; i++) {
-        dracView->trail[i]->location = trail[i];
-        whatsThere(dracView, trail[i], &dracView->trail[i]->numTraps,
-                   &dracView->trail[i]->numVamps);
+    giveMeTheTrail(dracView, PLAYER_DRACULA, hideTrail, TRUE);
+    // oldest first, so a place he has been to twice keeps the newest
+    for (i = TRAIL_SIZE - 1; i >= 0; i--) {
+        if (!validPlace(trail[i])) continue;
+        dracView->places[trail[i]].trailPos = i;
+        dracView->places[trail[i]].move = hideTrail[i];
     }
+    dracView->specialMoves = hasDBOrHI(hideTrail);
+    dracView->dbPos = posOfDb(hideTrail);
+}
+
+// Creates a new DracView to summarise the current state of the game
+DracView newDracView(char *pastPlays, PlayerMessage messages[]) {
+    DracView dracView = malloc(sizeof(struct dracView));
+    assert(dracView != NULL);
+    dracView->view = newGameView(pastPlays, messages);
+    updateTrail(dracView);
     return dracView;
 }
 
+// Advances the DracView by the plays made since it was created or last advanced
+void appendDracPlays(DracView currentView, char *newPlays, PlayerMessage messages[]) {
+    assert(currentView != NULL && currentView->view != NULL);
+    appendPlays(currentView->view, newPlays, messages);
+    updateTrail(currentView);
+}
+
 // Frees all memory previously allocated for the DracView toBeDeleted
 void disposeDracView(DracView toBeDeleted) {
     assert(toBeDeleted != NULL);
 
-    int i;
     disposeGameView(toBeDeleted->view);
-    for (i = 0; i < TRAIL_SIZE ; i++) {
-        free(toBeDeleted->trail[i]);
-        toBeDeleted->trail[i] = NULL;
-    }
     free(toBeDeleted);
     toBeDeleted = NULL;
 }
@@ -83,8 +100,7 @@ int howHealthyIs(DracView currentView, PlayerID player) {
 LocationID whereIs(DracView currentView, PlayerID player) {
     assert(currentView != NULL && currentView->view != NULL);
     assert(player >= PLAYER_LORD_GODALMING && player < NUM_PLAYERS);
-
-    return getLocation(currentView->view, player);
+    return currentView->view->players[player]->playerCurrLocation;
 }
 
 // Get the most recent move of a given player
@@ -106,58 +122,14 @@ void whatsThere(DracView currentView, LocationID where,
     assert(currentView != NULL && currentView->view != NULL);
     assert(validPlace(where) || where == NOWHERE);
 
-    int i, j;
-    //index place of first move of Dracula in pastPlays
-    ///int firstMove = PLAYER_DRACULA * CHARS_PER_TURN;
-    int nChar = countChar(currentView->view->pastPlays);
-    LocationID trail[TRAIL_SIZE];
-    LocationID fallOffLoc;
-    *numTraps = 0;        //initialise to 0 before counting
-    *numVamps = 0;        //initialise to 0 before counting
-
-    if (where == NOWHERE || idToType(where) == SEA) {
+    //counted when the encounter table was filled
+    if (!validPlace(where)) {
+        *numTraps = 0;
+        *numVamps = 0;
         return;
-    } else {
-        LocationID currID;
-        char currLocation[3];
-        initialiseTrail(trail);
-//        //loop and keep updating trail of Dracula till the last round
-//        for (i = firstMove; i < nChar - 2; i += CHARS_PER_ROUND) {
-//            updatePlayerTrail(trail, &currentView->view->pastPlays[i],
-//                              PLAYER_DRACULA);
-//            if (trail[0] == where) {
-//                //update the number of encounters occurred in that place
-//                numEncounter(trail, currentView->view->pastPlays[i+3],
-//                             where, numTraps, numVamps);
-//                numEncounter(trail, currentView->view->pastPlays[i+4],
-//                             where, numTraps, numVamps);
-//            }
-//        }
-        for (i = 0; i < nChar - 2; i += CHARS_PER_TURN) {
-            if (currentView->view->pastPlays[i] == 'D') {
-                fallOffLoc = trail[5];
-                updatePlayerTrail(trail, &currentView->view->pastPlays[i],
-                                  PLAYER_DRACULA);
-                if (fallOffLoc == where) {
-                    if (currentView->view->pastPlays[i+5] == 'M') *numTraps = 0;
-                    if (currentView->view->pastPlays[i+5] == 'V') *numVamps = 0;
-                }
-                if (trail[0] == where) {
-                    if (currentView->view->pastPlays[i+3] == 'T') (*numTraps)++;
-                    if (currentView->view->pastPlays[i+4] == 'V') (*numVamps)++;
-                }
-            } else {
-                strToAbbrev(&currentView->view->pastPlays[i], currLocation);
-                currID = abbrevToID(currLocation);
-                if (currID == where) {
-                    for (j = 0; j < NUM_EVENT_ENCOUNTER; j++) {
-                        if (currentView->view->pastPlays[i+3+j] == 'T') (*numTraps)--;
-                        if (currentView->view->pastPlays[i+3+j] == 'V') (*numVamps)--;
-                    }
-                }
-            }
-        }
     }
+    *numTraps = currentView->places[where].numTraps;
+    *numVamps = currentView->places[where].numVamps;
     return;
 }
 
@@ -170,16 +142,16 @@ void giveMeTheTrail(DracView currentView, PlayerID player,
     assert(player >= PLAYER_LORD_GODALMING && player < NUM_PLAYERS);
 
     int i;
-    //index place of first move of player in pastPlays
-    int firstMove = player * CHARS_PER_TURN;
-    int nChar = countChar(currentView->view->pastPlays);
 
     if (!hide) {
-        initialiseTrail(trail);
-        //loop and keep updating trail of Dracula till the last round
-        for (i = firstMove; i < nChar - 2; i += CHARS_PER_ROUND) {
-            updatePlayerTrail(trail, &currentView->view->pastPlays[i],
-                              PLAYER_DRACULA);
+        //Dracula's real trail is kept as the plays are read,
+        // hunters' plays have nothing to resolve
+        if (player == PLAYER_DRACULA) {
+            for (i = 0; i < TRAIL_SIZE; i++) {
+                trail[i] = currentView->view->dracTrail[i];
+            }
+        } else {
+            getHistory(currentView->view, player, trail);
         }
     } else {
         //put original locations in the trail if the player is a hunter
@@ -188,6 +160,34 @@ void giveMeTheTrail(DracView currentView, PlayerID player,
     return;
 }
 
+// How many turns ago Dracula was last at where, or -1 if it is not in his trail
+int trailPosition(DracView currentView, LocationID where) {
+    assert(currentView != NULL && currentView->view != NULL);
+    assert(validPlace(where) || where == NOWHERE);
+    if (!validPlace(where)) return -1;
+    return currentView->places[where].trailPos;
+}
+
+// The move Dracula made to get to where, or NOWHERE if it is not in his trail
+LocationID trailMove(DracView currentView, LocationID where) {
+    assert(currentView != NULL && currentView->view != NULL);
+    assert(validPlace(where) || where == NOWHERE);
+    if (!validPlace(where)) return NOWHERE;
+    return currentView->places[where].move;
+}
+
+// Whether there is a hide and/or a double back in Dracula's trail
+int specialMovesInTrail(DracView currentView) {
+    assert(currentView != NULL && currentView->view != NULL);
+    return currentView->specialMoves;
+}
+
+// Where the double back in Dracula's trail is, or -1 if there isn't one
+int doubleBackPosition(DracView currentView) {
+    assert(currentView != NULL && currentView->view != NULL);
+    return currentView->dbPos;
+}
+
 //// Functions that query the map to find information about connectivity
 // What are my (Dracula's) possible next moves (locations)
 LocationID *whereCanDracgo(DracView currentView, int *numLocations,
@@ -295,15 +295,28 @@ LocationID *whereCanTheyGo(DracView currentView, int *numLocations,
                               from, player, round, road, rail, sea);
 }
 
+// What are the specified player's next possible moves
+// the locations are stored in moves and their number is returned
+int fillWhereCanTheyGo(DracView currentView, LocationID moves[NUM_MAP_LOCATIONS],
+                       LocationID from, PlayerID player, Round round,
+                       int road, int rail, int sea) {
+    assert(currentView != NULL && currentView->view != NULL);
+    assert(player >= PLAYER_LORD_GODALMING && player < NUM_PLAYERS);
+    return fillConnectedLocations(moves,
+                                  from, player, round, road, rail, sea);
+}
+
 // check where dracula can go from a given location
-LocationID *whereCanIgo(int *numLocations, LocationID trail[TRAIL_SIZE],
-                        LocationID hideTrail[TRAIL_SIZE], LocationID currLoc,
-                        int road, int sea) {
-    LocationID *adjLoc = connectedLocations(numLocations,
-                                            currLoc, PLAYER_DRACULA,
-                                            1, road, FALSE, sea);
+// the locations are stored in adjLoc and their number is returned
+int fillWhereCanIgo(LocationID adjLoc[NUM_MAP_LOCATIONS],
+                    LocationID trail[TRAIL_SIZE],
+                    LocationID hideTrail[TRAIL_SIZE], LocationID currLoc,
+                    int road, int sea) {
+    int numLocations = fillConnectedLocations(adjLoc,
+                                              currLoc, PLAYER_DRACULA,
+                                              1, road, FALSE, sea);
 //int y;
-//for (y = 0;y<*numLocations;y++) {
+//for (y = 0;y<numLocations;y++) {
 //printf("connection = %s\n",idToName(adjLoc[y]));}
     int i, index;
     shiftRight(hideTrail, 0, TRAIL_SIZE - 1);
@@ -319,42 +332,50 @@ LocationID *whereCanIgo(int *numLocations, LocationID trail[TRAIL_SIZE],
         if (idToType(currLoc) != SEA) noShift = 1;
         for (i = 1; i < TRAIL_SIZE; i++) {
             if (trail[i] == currLoc && idToType(currLoc) != SEA) noShift = 1;
-            index = inArray(adjLoc, trail[i], *numLocations);
+            index = inArray(adjLoc, trail[i], numLocations);
             //if ((i == 5) && (hideTrail[5] == HIDE)) noShift = 1;
             //if (hideTrail[i] == HIDE && i == dbPos - 1) noShift = 1;
             if ((index != -1) && (i != dbPos) && (noShift != 1)) {
-                shiftLeft(adjLoc, index, (*numLocations) - 1);
-                (*numLocations)--;
-                if ((*numLocations) > 0) {
-                    adjLoc = realloc(adjLoc, (*numLocations) * sizeof(LocationID));
-                    assert(adjLoc != NULL);
-                } else {
-                    free(adjLoc);
-                    adjLoc = NULL;
-                }
+                shiftLeft(adjLoc, index, numLocations - 1);
+                numLocations--;
             }
             noShift = 0;
         }
     } else if (dbOrHi == BOTH_HIDE_AND_DB) {
         for (i = 1; i < TRAIL_SIZE; i++) {
-            index = inArray(adjLoc, trail[i], *numLocations);
+            index = inArray(adjLoc, trail[i], numLocations);
             //if ((i == 5) && (hideTrail[5] == HIDE)) noShift = 1;
             //if (hideTrail[i] == HIDE && i == dbPos - 1) noShift = 1;
             //if (hideTrail[i] == TELEPORT) noShift = 1;
 //printf("index=%d, dbPos=%d,i=%d\n",index, dbPos, i);
             if ((index != -1) && (i != dbPos) && (hideTrail[i] != HIDE)) {
 //printf("del\n");
-                shiftLeft(adjLoc, index, (*numLocations) - 1);
-                (*numLocations)--;
-                if ((*numLocations) > 0) {
-                    adjLoc = realloc(adjLoc, (*numLocations) * sizeof(LocationID));
-                    assert(adjLoc != NULL);
-                } else {
-                    free(adjLoc);
-                    adjLoc = NULL;
-                }
+                shiftLeft(adjLoc, index, numLocations - 1);
+                numLocations--;
             }
         }
     }
-    return adjLoc;
+    return numLocations;
+}
+
+// check where dracula can go from a given location
+// (the same as fillWhereCanIgo() but the array is allocated for the caller)
+LocationID *whereCanIgo(int *numLocations, LocationID trail[TRAIL_SIZE],
+                        LocationID hideTrail[TRAIL_SIZE], LocationID currLoc,
+                        int road, int sea) {
+    LocationID adjLoc[NUM_MAP_LOCATIONS];
+    LocationID *result = NULL;
+    *numLocations = fillWhereCanIgo(adjLoc, trail, hideTrail, currLoc, road, sea);
+    if (*numLocations > 0) {
+        result = malloc((*numLocations) * sizeof(LocationID));
+        assert(result != NULL);
+        memcpy(result, adjLoc, (*numLocations) * sizeof(LocationID));
+    }
+    return result;
+}
+
+// Fill in a GameState with the current state of the game
+void dracViewToState(DracView currentView, GameState *state) {
+    assert(currentView != NULL && currentView->view != NULL);
+    viewToState(currentView->view, state);
 }
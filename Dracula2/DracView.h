@@ -9,6 +9,7 @@
 #include "Game.h"
 #include "Places.h"
 #include "GameView.h"
+#include "GameState.h"
 
 typedef struct dracView *DracView;
 
@@ -33,6 +34,13 @@ typedef struct dracView *DracView;
 DracView newDracView(char *pastPlays, PlayerMessage messages[]);
 
 
+// appendDracPlays() advances an existing DracView by the plays made since it
+// was created (or last advanced), like appendPlays() does for a GameView,
+// so an AI that stays running between turns only reads each play once.
+
+void appendDracPlays(DracView currentView, char *newPlays, PlayerMessage messages[]);
+
+
 // disposeDracView() frees all memory previously allocated for the DracView
 // toBeDeleted. toBeDeleted should not be accessed after the call.
 
@@ -102,6 +110,21 @@ void whatsThere(DracView currentView, LocationID where,
 void giveMeTheTrail(DracView currentView, PlayerID player,
                         LocationID trail[TRAIL_SIZE], int hide);
 
+// The encounter table: everything below is worked out once when the view
+//   is made (or advanced), so each question is a single lookup
+// trailPosition() gives how many turns ago Dracula was last at where
+//   (0 is where he is now), or -1 if where is not in his trail
+// trailMove() gives the move he made to get there: where itself, HIDE or
+//   DOUBLE_BACK_n (TELEPORT shows up as CASTLE_DRACULA), or NOWHERE if
+//   where is not in his trail
+// specialMovesInTrail() and doubleBackPosition() are what hasDBOrHI() and
+//   posOfDb() say about his trail with hides and double backs in it
+
+int trailPosition(DracView currentView, LocationID where);
+LocationID trailMove(DracView currentView, LocationID where);
+int specialMovesInTrail(DracView currentView);
+int doubleBackPosition(DracView currentView);
+
 
 //// Functions that query the map to find information about connectivity
 
@@ -141,4 +164,23 @@ LocationID *whereCanIgo(int *numLocations, LocationID trail[TRAIL_SIZE],
                           LocationID hideTrail[TRAIL_SIZE], LocationID currLoc,
                           int road, int sea);
 
+// fillWhereCanTheyGo() and fillWhereCanIgo() give the same locations as
+//   whereCanTheyGo() and whereCanIgo() but store them in the given array
+//   (which needs room for every location) and return how many there are,
+//   so nothing has to be allocated or freed
+// Like whereCanIgo(), fillWhereCanIgo() moves trail and hideTrail on a turn
+
+int fillWhereCanTheyGo(DracView currentView, LocationID moves[NUM_MAP_LOCATIONS],
+                       LocationID from, PlayerID player, Round round,
+                       int road, int rail, int sea);
+int fillWhereCanIgo(LocationID adjLoc[NUM_MAP_LOCATIONS],
+                    LocationID trail[TRAIL_SIZE],
+                    LocationID hideTrail[TRAIL_SIZE], LocationID currLoc,
+                    int road, int sea);
+
+// dracViewToState() fills in a GameState (see GameState.h) with the
+//   current state of the game, for simulating moves without a new view
+
+void dracViewToState(DracView currentView, GameState *state);
+
 #endif
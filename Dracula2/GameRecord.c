@@ -0,0 +1,285 @@
+// GameRecord.c ... packing games into binary records and reading them back
+//
+// The first byte of a play is the LocationID of the place or special move
+// (places are 0 ... 70, C? ... TP are 100 ... 108). The second holds the
+// encounters:
+//   hunters: bits 0-1 the number of traps met, bit 2 an immature vampire,
+//            bit 3 Dracula (in the text they always come in that order)
+//   Dracula: bit 0 a trap placed, bit 1 a vampire placed, bit 2 a trap
+//            left the trail, bit 3 a vampire matured
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "GameRecord.h"
+#include "Places.h"
+
+#define HEADER         "FDG1"
+#define HEADER_BYTES   4
+#define COUNT_BYTES    2
+#define MAX_PLAYS      ((GAME_START_SCORE + 1) * NUM_PLAYERS)
+
+// hunters' encounter bits
+#define TRAPS_MET      3
+#define VAMPIRE_MET    4
+#define DRACULA_MET    8
+
+// Dracula's encounter bits
+#define TRAP_PLACED    1
+#define VAMPIRE_PLACED 2
+#define TRAP_LEFT      4
+#define VAMPIRE_GREW   8
+
+static const char playerLetter[NUM_PLAYERS] = {'G', 'S', 'H', 'M', 'D'};
+
+struct recordWriter {
+    FILE *out;
+    unsigned char plays[MAX_PLAYS * RECORD_BYTES];
+    int failed;
+};
+
+struct recordReader {
+    int fd;
+    const unsigned char *base;
+    size_t size;
+    size_t next;                   // where the next game starts
+};
+
+// the two characters for a place or special move, or 0 if there are none
+static int moveToText(int move, char text[2])
+{
+    static const char *special[] = {"C?", "S?", "HI", "D1", "D2", "D3", "D4", "D5", "TP"};
+    char abbrev[3];
+
+    if (validPlace(move)) {
+        idToAbbrev(move, abbrev);
+        memcpy(text, abbrev, 2);
+        return 1;
+    }
+    if (move >= CITY_UNKNOWN && move <= TELEPORT) {
+        memcpy(text, special[move - CITY_UNKNOWN], 2);
+        return 1;
+    }
+    return 0;
+}
+
+static int textToMove(char *text)
+{
+    static const char *special[] = {"C?", "S?", "HI", "D1", "D2", "D3", "D4", "D5", "TP"};
+    char abbrev[3] = {text[0], text[1], '\0'};
+    int i;
+
+    for (i = 0; i <= TELEPORT - CITY_UNKNOWN; i++) {
+        if (abbrev[0] == special[i][0] && abbrev[1] == special[i][1]) return CITY_UNKNOWN + i;
+    }
+    return abbrevToID(abbrev);
+}
+
+// the encounter byte for the last four characters of a play, or -1 if
+//  they aren't ones the game would write
+static int packEncounters(char *chars, PlayerID player)
+{
+    int bits = 0, i = 0;
+
+    if (player == PLAYER_DRACULA) {
+        if (chars[0] == 'T') bits |= TRAP_PLACED;
+        else if (chars[0] != '.') return -1;
+        if (chars[1] == 'V') bits |= VAMPIRE_PLACED;
+        else if (chars[1] != '.') return -1;
+        if (chars[2] == 'M') bits |= TRAP_LEFT;
+        else if (chars[2] == 'V') bits |= VAMPIRE_GREW;
+        else if (chars[2] != '.') return -1;
+        return (chars[3] == '.') ? bits : -1;
+    }
+    while (i < 3 && chars[i] == 'T') i++;
+    bits = i;
+    if (chars[i] == 'V') {
+        bits |= VAMPIRE_MET;
+        i++;
+    }
+    if (i < 4 && chars[i] == 'D') {
+        bits |= DRACULA_MET;
+        i++;
+    }
+    for (; i < 4; i++) {
+        if (chars[i] != '.') return -1;
+    }
+    return bits;
+}
+
+static void unpackEncounters(int bits, PlayerID player, char *chars)
+{
+    int i = 0, t;
+
+    memset(chars, '.', 4);
+    if (player == PLAYER_DRACULA) {
+        if (bits & TRAP_PLACED) chars[0] = 'T';
+        if (bits & VAMPIRE_PLACED) chars[1] = 'V';
+        if (bits & TRAP_LEFT) chars[2] = 'M';
+        if (bits & VAMPIRE_GREW) chars[2] = 'V';
+        return;
+    }
+    for (t = 0; t < (bits & TRAPS_MET); t++) chars[i++] = 'T';
+    if (bits & VAMPIRE_MET) chars[i++] = 'V';
+    if (bits & DRACULA_MET) chars[i++] = 'D';
+}
+
+int packPlays(char *pastPlays, unsigned char *bytes, int maxPlays)
+{
+    char *p = pastPlays;
+    int nPlays = 0, move, bits, i;
+    PlayerID player;
+
+    assert(pastPlays != NULL && bytes != NULL);
+    while (*p == ' ') p++;
+    while (*p != '\0') {
+        if (nPlays == maxPlays) return -1;
+        for (i = 0; i < PLAY_CHARS; i++) {
+            if (p[i] == '\0') return -1;
+        }
+        player = nPlays % NUM_PLAYERS;
+        if (p[0] != playerLetter[player]) return -1;
+        move = textToMove(&p[1]);
+        if (move == NOWHERE) return -1;
+        if (player != PLAYER_DRACULA && !validPlace(move)) return -1;
+        bits = packEncounters(&p[3], player);
+        if (bits < 0) return -1;
+        bytes[nPlays * RECORD_BYTES] = move;
+        bytes[nPlays * RECORD_BYTES + 1] = bits;
+        nPlays++;
+
+        p += PLAY_CHARS;
+        if (*p == ' ') p++;
+        else if (*p != '\0') return -1;
+    }
+    return nPlays;
+}
+
+void unpackPlay(GameRecord *game, int turn, char play[PLAY_CHARS + 1])
+{
+    const unsigned char *packed;
+    PlayerID player = turn % NUM_PLAYERS;
+
+    assert(game != NULL && turn >= 0 && turn < game->nPlays);
+    packed = &game->plays[turn * RECORD_BYTES];
+    play[0] = playerLetter[player];
+    if (!moveToText(packed[0], &play[1])) memcpy(&play[1], "??", 2);
+    unpackEncounters(packed[1], player, &play[3]);
+    play[PLAY_CHARS] = '\0';
+}
+
+void recordToText(GameRecord *game, char *pastPlays)
+{
+    int turn;
+
+    pastPlays[0] = '\0';
+    for (turn = 0; turn < game->nPlays; turn++) {
+        if (turn > 0) *pastPlays++ = ' ';
+        unpackPlay(game, turn, pastPlays);
+        pastPlays += PLAY_CHARS;
+    }
+}
+
+RecordWriter newRecordWriter(FILE *out)
+{
+    RecordWriter writer = malloc(sizeof(struct recordWriter));
+    assert(writer != NULL && out != NULL);
+    writer->out = out;
+    writer->failed = (fwrite(HEADER, 1, HEADER_BYTES, out) != HEADER_BYTES);
+    return writer;
+}
+
+int writeGame(RecordWriter writer, char *pastPlays)
+{
+    unsigned char count[COUNT_BYTES];
+    int nPlays = packPlays(pastPlays, writer->plays, MAX_PLAYS);
+
+    if (nPlays < 0) return -1;
+    count[0] = nPlays & 0xff;
+    count[1] = nPlays >> 8;
+    if (fwrite(count, 1, COUNT_BYTES, writer->out) != COUNT_BYTES ||
+        fwrite(writer->plays, RECORD_BYTES, nPlays, writer->out) != (size_t)nPlays) {
+        writer->failed = 1;
+    }
+    return 0;
+}
+
+int disposeRecordWriter(RecordWriter writer)
+{
+    int failed = writer->failed || fflush(writer->out) != 0;
+    free(writer);
+    return failed ? -1 : 0;
+}
+
+RecordReader openRecords(char *path)
+{
+    RecordReader reader;
+    struct stat info;
+    void *base;
+    int fd = open(path, O_RDONLY);
+
+    if (fd < 0) return NULL;
+    if (fstat(fd, &info) < 0 || info.st_size < HEADER_BYTES) {
+        close(fd);
+        return NULL;
+    }
+    base = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (base == MAP_FAILED || memcmp(base, HEADER, HEADER_BYTES) != 0) {
+        if (base != MAP_FAILED) munmap(base, info.st_size);
+        close(fd);
+        return NULL;
+    }
+    // the games are read front to back
+    madvise(base, info.st_size, MADV_SEQUENTIAL);
+
+    reader = malloc(sizeof(struct recordReader));
+    assert(reader != NULL);
+    reader->fd = fd;
+    reader->base = base;
+    reader->size = info.st_size;
+    reader->next = HEADER_BYTES;
+    return reader;
+}
+
+int nextGame(RecordReader reader, GameRecord *game)
+{
+    const unsigned char *p = reader->base + reader->next;
+    size_t left = reader->size - reader->next;
+    int nPlays;
+
+    if (left < COUNT_BYTES) return 0;
+    nPlays = p[0] | (p[1] << 8);
+    if (left - COUNT_BYTES < (size_t)nPlays * RECORD_BYTES) return 0;
+    game->plays = p + COUNT_BYTES;
+    game->nPlays = nPlays;
+    reader->next += COUNT_BYTES + (size_t)nPlays * RECORD_BYTES;
+    return 1;
+}
+
+void closeRecords(RecordReader reader)
+{
+    munmap((void *)reader->base, reader->size);
+    close(reader->fd);
+    free(reader);
+}
+
+GameView replayGame(GameRecord *game,
+                    void (*visit)(GameView view, int turn, void *data),
+                    void *data)
+{
+    PlayerMessage messages[1] = {""};
+    char play[PLAY_CHARS + 1];
+    GameView view = newGameView("", messages);
+    int turn;
+
+    for (turn = 0; turn < game->nPlays; turn++) {
+        unpackPlay(game, turn, play);
+        appendPlays(view, play, messages);
+        if (visit != NULL) visit(view, turn, data);
+    }
+    return view;
+}
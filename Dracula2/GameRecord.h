@@ -0,0 +1,76 @@
+// GameRecord.h ... games stored as packed binary records
+//
+// As text every play takes eight characters ("GLO.... "), and reading a
+// game back means parsing them all again. A record keeps each play in
+// two bytes: the place or special move (C?, HI, D3 ...) in one and what
+// was met or left there in the other. Whose play it is follows from its
+// position, as in the text.
+//
+// A file of records is a four byte header ("FDG1") followed by the games
+// back to back, each a two byte play count (low byte first) and then
+// its plays. A file is written one game at a time, and read by mapping
+// the whole of it into memory and walking through the games in place,
+// so archives of millions of games cost no more to read than their size.
+
+#ifndef GAMERECORD_H
+#define GAMERECORD_H
+
+#include <stdio.h>
+#include "Globals.h"
+#include "GameView.h"
+
+#define RECORD_BYTES   2            // bytes for each play
+#define PLAY_CHARS     7            // "GLO...." without the space after it
+
+// one game, pointing at its plays in a mapped file or a buffer
+typedef struct gameRecord {
+    const unsigned char *plays;     // RECORD_BYTES for each play, in order
+    int nPlays;
+} GameRecord;
+
+typedef struct recordWriter *RecordWriter;
+typedef struct recordReader *RecordReader;
+
+// pack the plays in a past plays string into bytes (which needs
+//  RECORD_BYTES for each of at most maxPlays plays)
+// returns the number of plays, or -1 if the string isn't a valid game
+int packPlays(char *pastPlays, unsigned char *bytes, int maxPlays);
+
+// the text of play "turn" of a game, with a '\0' after it
+void unpackPlay(GameRecord *game, int turn, char play[PLAY_CHARS + 1]);
+
+// the whole game as a past plays string, which needs room for
+//  nPlays * (PLAY_CHARS + 1) characters
+void recordToText(GameRecord *game, char *pastPlays);
+
+// start a file of records on out (which stays open and owned by the caller)
+RecordWriter newRecordWriter(FILE *out);
+
+// add a game, given as a past plays string
+// returns 0, or -1 (and writes nothing) if it isn't a valid game
+int writeGame(RecordWriter writer, char *pastPlays);
+
+// flush what is left and free the writer
+// returns 0, or -1 if anything failed to be written
+int disposeRecordWriter(RecordWriter writer);
+
+// map a file of records for reading, or return NULL if it can't be
+//  opened or isn't one
+RecordReader openRecords(char *path);
+
+// the next game in the file, pointing into the mapping (so only valid
+//  until the reader is closed)
+// returns 1, or 0 when there are no more games (or the rest is cut short)
+int nextGame(RecordReader reader, GameRecord *game);
+
+// unmap the file
+void closeRecords(RecordReader reader);
+
+// play a game into a new GameView one play at a time, calling visit
+//  (if it isn't NULL) after each play with the view and the turn just played
+// returns the view after the last play, which the caller disposes of
+GameView replayGame(GameRecord *game,
+                    void (*visit)(GameView view, int turn, void *data),
+                    void *data);
+
+#endif
@@ -0,0 +1,242 @@
+// GameState.c ... GameState implementation
+
+#include <assert.h>
+#include <string.h>
+#include "Globals.h"
+#include "Game.h"
+#include "GameState.h"
+#include "commonFunctions.h"
+
+#define MAX_ENCOUNTERS    3    // traps and vampires one city can hold
+
+// the state must stay small enough to copy about freely
+_Static_assert(sizeof(GameState) <= 256, "GameState should fit in 256 bytes");
+
+// is where (a place or CITY_UNKNOWN and so on) out at sea
+static int atSea(LocationID where)
+{
+    if (where == SEA_UNKNOWN) return TRUE;
+    return validPlace(where) && idToType(where) == SEA;
+}
+
+// the place a move by Dracula takes him to
+static LocationID dracDest(GameState *state, LocationID move)
+{
+    if (move == HIDE) return state->trail[0];
+    if (move >= DOUBLE_BACK_1 && move <= DOUBLE_BACK_5) {
+        return state->trail[move - DOUBLE_BACK_1];
+    }
+    if (move == TELEPORT) return CASTLE_DRACULA;
+    return move;
+}
+
+void viewToState(GameView view, GameState *state)
+{
+    assert(view != NULL && state != NULL);
+    PlayerID player;
+    LocationID where, trail[TRAIL_SIZE], moves[TRAIL_SIZE];
+    int traps[NUM_MAP_LOCATIONS], vamps[NUM_MAP_LOCATIONS];
+    int numDracMoves = view->nTurns / NUM_PLAYERS;
+    int i;
+
+    memset(state, 0, sizeof(GameState));
+    for (player = PLAYER_LORD_GODALMING; player < NUM_PLAYERS; player++) {
+        state->health[player] = view->players[player]->playerHealth;
+        state->location[player] = view->players[player]->playerCurrLocation;
+    }
+    state->score = view->gameScore;
+    state->round = view->roundNumber;
+    state->player = view->currentPlayer;
+    memcpy(traps, view->numTraps, sizeof(traps));
+    memcpy(vamps, view->numVamps, sizeof(vamps));
+
+    // the view only counts what is at each place, so give the traps to the
+    //  most recent visits (hunters clear out a place all at once, so what is
+    //  left was all laid since the last one came by) and the vampire to the
+    //  visit made in a round when vampires are laid
+    for (i = 0; i < TRAIL_SIZE; i++) {
+        where = view->dracTrail[i];
+        state->trail[i] = where;
+        state->moves[i] = view->players[PLAYER_DRACULA]->playerTrail[i];
+        if (where == CITY_UNKNOWN) {
+            // a vampire found by a hunter would have shown where he was
+            if ((numDracMoves - 1 - i) % 13 == 0) state->minions[i] |= VAMPIRE_HERE;
+            continue;
+        }
+        if (!validPlace(where)) continue;
+        if (vamps[where] > 0 && (numDracMoves - 1 - i) % 13 == 0) {
+            state->minions[i] |= VAMPIRE_HERE;
+            vamps[where]--;
+        } else if (traps[where] > 0) {
+            state->minions[i] |= TRAP_HERE;
+            traps[where]--;
+        }
+    }
+    stateTrail(state, trail, moves);
+    state->trailHash = trailKey(trail, moves);
+    state->hash = stateHash(state);
+}
+
+HashKey stateHash(GameState *state)
+{
+    LocationID trail[TRAIL_SIZE], moves[TRAIL_SIZE];
+    HashKey key;
+    PlayerID player;
+
+    stateTrail(state, trail, moves);
+    key = trailKey(trail, moves) ^ roundKey(state->round);
+    for (player = PLAYER_LORD_GODALMING; player < NUM_PLAYERS; player++) {
+        if (player != PLAYER_DRACULA) key ^= playerKey(player, state->location[player]);
+        key ^= healthKey(player, state->health[player]);
+    }
+    return key;
+}
+
+// set a player's health, keeping the hash in step
+static void setHealth(GameState *state, PlayerID player, int health)
+{
+    state->hash ^= healthKey(player, state->health[player]) ^ healthKey(player, health);
+    state->health[player] = health;
+}
+
+// Dracula moves and leaves a trap or a vampire behind if he can
+static void dracMove(GameState *state, LocationID move)
+{
+    LocationID dest = dracDest(state, move);
+    int health = state->health[PLAYER_DRACULA];
+    int i, here = 0;
+    HashKey trailHash;
+
+    // a vampire that drops off the end of the trail has matured
+    if (state->minions[TRAIL_SIZE - 1] & VAMPIRE_HERE) {
+        state->score -= SCORE_LOSS_VAMPIRE_MATURES;
+    }
+    trailHash = pushTrailKey(state->trailHash,
+                             state->trail[TRAIL_SIZE - 1], state->moves[TRAIL_SIZE - 1],
+                             dest, move);
+    state->hash ^= state->trailHash ^ trailHash;
+    state->trailHash = trailHash;
+    for (i = TRAIL_SIZE - 1; i > 0; i--) {
+        state->trail[i] = state->trail[i - 1];
+        state->moves[i] = state->moves[i - 1];
+        state->minions[i] = state->minions[i - 1];
+    }
+    state->trail[0] = dest;
+    state->moves[0] = move;
+    state->minions[0] = 0;
+    state->location[PLAYER_DRACULA] = dest;
+
+    if (atSea(dest)) {
+        health -= LIFE_LOSS_SEA;
+    } else {
+        if (dest == CASTLE_DRACULA) health += LIFE_GAIN_CASTLE_DRACULA;
+        for (i = 1; i < TRAIL_SIZE; i++) {
+            if (state->trail[i] == dest && state->minions[i] != 0) here++;
+        }
+        if (here < MAX_ENCOUNTERS) {
+            state->minions[0] = (state->round % 13 == 0) ? VAMPIRE_HERE : TRAP_HERE;
+        }
+    }
+    setHealth(state, PLAYER_DRACULA, health);
+    state->score -= SCORE_LOSS_DRACULA_TURN;
+}
+
+// a hunter moves and meets whatever is there
+static void hunterMove(GameState *state, PlayerID player, LocationID dest)
+{
+    LocationID from = state->location[player];
+    int health = state->health[player];
+    int i;
+
+    state->hash ^= playerKey(player, from) ^ playerKey(player, dest);
+    state->location[player] = dest;
+    for (i = 0; i < TRAIL_SIZE; i++) {
+        if (state->trail[i] != dest) continue;
+        // traps go off and immature vampires are killed
+        if (state->minions[i] & TRAP_HERE) health -= LIFE_LOSS_TRAP_ENCOUNTER;
+        state->minions[i] = 0;
+    }
+    if (validPlace(dest) && dest == state->location[PLAYER_DRACULA] && !atSea(dest)) {
+        health -= LIFE_LOSS_DRACULA_ENCOUNTER;
+        setHealth(state, PLAYER_DRACULA,
+                  state->health[PLAYER_DRACULA] - LIFE_LOSS_HUNTER_ENCOUNTER);
+    }
+
+    if (health <= 0) {
+        // off to the hospital with full health
+        health = GAME_START_HUNTER_LIFE_POINTS;
+        state->score -= SCORE_LOSS_HUNTER_HOSPITAL;
+        state->hash ^= playerKey(player, dest) ^ playerKey(player, ST_JOSEPH_AND_ST_MARYS);
+        state->location[player] = ST_JOSEPH_AND_ST_MARYS;
+    } else if (dest == from) {
+        health += LIFE_GAIN_REST;
+        if (health > GAME_START_HUNTER_LIFE_POINTS) health = GAME_START_HUNTER_LIFE_POINTS;
+    }
+    setHealth(state, player, health);
+}
+
+void applyMove(GameState *state, LocationID move, MoveUndo *undo)
+{
+    assert(state != NULL && undo != NULL);
+    PlayerID player = state->player;
+
+    undo->hash = state->hash;
+    undo->trailHash = state->trailHash;
+    undo->health[0] = state->health[player];
+    undo->health[1] = state->health[PLAYER_DRACULA];
+    undo->score = state->score;
+    undo->location = state->location[player];
+    undo->lostTrail = state->trail[TRAIL_SIZE - 1];
+    undo->lostMove = state->moves[TRAIL_SIZE - 1];
+    memcpy(undo->minions, state->minions, sizeof(undo->minions));
+
+    if (player == PLAYER_DRACULA) {
+        dracMove(state, move);
+    } else {
+        assert(validPlace(move));
+        hunterMove(state, player, move);
+    }
+
+    state->player = (player + 1) % NUM_PLAYERS;
+    if (state->player == PLAYER_LORD_GODALMING) {
+        state->hash ^= roundKey(state->round) ^ roundKey(state->round + 1);
+        state->round++;
+    }
+}
+
+void undoMove(GameState *state, MoveUndo *undo)
+{
+    assert(state != NULL && undo != NULL);
+    PlayerID player;
+    int i;
+
+    if (state->player == PLAYER_LORD_GODALMING) state->round--;
+    player = (state->player + NUM_PLAYERS - 1) % NUM_PLAYERS;
+    state->player = player;
+
+    if (player == PLAYER_DRACULA) {
+        for (i = 0; i < TRAIL_SIZE - 1; i++) {
+            state->trail[i] = state->trail[i + 1];
+            state->moves[i] = state->moves[i + 1];
+        }
+        state->trail[TRAIL_SIZE - 1] = undo->lostTrail;
+        state->moves[TRAIL_SIZE - 1] = undo->lostMove;
+    }
+    state->location[player] = undo->location;
+    state->health[player] = undo->health[0];
+    state->health[PLAYER_DRACULA] = undo->health[1];
+    state->score = undo->score;
+    memcpy(state->minions, undo->minions, sizeof(state->minions));
+    state->hash = undo->hash;
+    state->trailHash = undo->trailHash;
+}
+
+void stateTrail(GameState *state, LocationID trail[TRAIL_SIZE],
+                LocationID moves[TRAIL_SIZE])
+{
+    int i;
+    for (i = 0; i < TRAIL_SIZE; i++) {
+        trail[i] = state->trail[i];
+        moves[i] = state->moves[i];
+    }
+}
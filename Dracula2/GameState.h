@@ -0,0 +1,70 @@
+// GameState.h ... a flat copy of the game state for simulating moves
+//
+// A GameView is built from the play string and owns several separate
+// blocks of memory, so trying out a move on one means building a new view.
+// A GameState holds just what the rules need in one small fixed-size
+// struct with no pointers in it, so it can be copied by assignment, kept
+// on the stack, and moved forwards and backwards with applyMove() and
+// undoMove() without allocating anything.
+
+#ifndef GAMESTATE_H
+#define GAMESTATE_H
+
+#include "Globals.h"
+#include "Places.h"
+#include "GameView.h"
+#include "TransTable.h"
+
+// what is left at each place in Dracula's trail
+#define TRAP_HERE      1
+#define VAMPIRE_HERE   2
+
+typedef struct gameState {
+    HashKey hash;                          // stateHash(), kept up to date by the moves
+    HashKey trailHash;                     // the trailKey() part of the hash
+    short health[NUM_PLAYERS];             // life or blood points of each player
+    short score;                           // current game score
+    short round;                           // current round
+    signed char player;                    // whose turn it is
+    signed char location[NUM_PLAYERS];     // where each player is
+    signed char trail[TRAIL_SIZE];         // where Dracula was, most recent first
+    signed char moves[TRAIL_SIZE];         // the moves that took him there (HI, D1 ...)
+    unsigned char minions[TRAIL_SIZE];     // TRAP_HERE and VAMPIRE_HERE for each trail entry
+} GameState;
+
+// what undoMove() needs to take back one move
+typedef struct moveUndo {
+    HashKey hash;
+    HashKey trailHash;
+    short health[2];                       // of the player who moved, then Dracula
+    short score;
+    signed char location;                  // where the player who moved was
+    signed char lostTrail;                 // the trail entry that fell off (Dracula only)
+    signed char lostMove;
+    unsigned char minions[TRAIL_SIZE];
+} MoveUndo;
+
+// fill in state from a GameView
+// places Dracula's trail entries aren't known by the view's owner
+//  are kept as CITY_UNKNOWN and so on
+void viewToState(GameView view, GameState *state);
+
+// the hash of a state from scratch: where everyone is, Dracula's trail,
+//  everyone's health and the round (see TransTable.h)
+HashKey stateHash(GameState *state);
+
+// make a move for the current player, filling in undo
+// a hunter's move is the place they go to; Dracula's is a place, HIDE,
+//  DOUBLE_BACK_1 ... DOUBLE_BACK_5 or TELEPORT
+// traps, vampires and encounters with Dracula follow the game rules
+void applyMove(GameState *state, LocationID move, MoveUndo *undo);
+
+// take back the last move made with applyMove()
+void undoMove(GameState *state, MoveUndo *undo);
+
+// copy Dracula's trail into LocationID arrays (like giveMeTheTrail()),
+//  the places he was and the moves that took him there
+void stateTrail(GameState *state, LocationID trail[TRAIL_SIZE],
+                LocationID moves[TRAIL_SIZE]);
+
+#endif
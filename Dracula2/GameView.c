@@ -9,52 +9,177 @@
 #include "GameView.h"
 #include "Map.h"       //use the Map ADT
 #include "Places.h"    //use the Places ADT
+#include "LocSet.h"    //sets of places as bitsets
+#include "Trace.h"     //optional timing of the hot functions
 #include "commonFunctions.h"    //Our ADT
 #include <time.h>
 
 // We have put the gameView struct to commonFunction.h
 //  for other files to access it
 
+// the first chunk of memory given to the pastPlays string
+#define INITIAL_PLAYS_SIZE  (CHARS_PER_ROUND * 8)
+
+static void readPlay(GameView currentView, char *play);
+static void removeMinion(int *count);
+
 // Creates a new GameView to summarise the current state of the game
 GameView newGameView(char *pastPlays, PlayerMessage messages[]) {
-    //int i;
-    int nChar = countChar(pastPlays);
+    TRACE_SCOPE(TRACE_NEW_GAME_VIEW);
+    PlayerID player;
 
     GameView currView = malloc(sizeof(struct gameView));
     assert(currView != NULL);
-    currView->pastPlays = malloc((nChar + 1) * sizeof(char));
+    currView->maxChars = INITIAL_PLAYS_SIZE;
+    currView->pastPlays = malloc(currView->maxChars * sizeof(char));
     assert(currView->pastPlays != NULL);
-    strcpy(currView->pastPlays, pastPlays);
-
-    currView->gameScore = getScore(currView);
-    currView->roundNumber = getRound(currView);
-    currView->currentPlayer = getCurrentPlayer(currView);
-
-    PlayerID player = currView->currentPlayer;
-    //if it is not before the first play (ie, messages is not empty)
-//    if (((nChar + 1)/CHARS_PER_TURN) != 0) {
-//        currView->messages = calloc(((nChar + 1)/CHARS_PER_TURN) ,
-//                                    sizeof(char[MESSAGE_SIZE]));
-//        assert(currView->messages != NULL);
-//        for (i = 0; i < currView->roundNumber * NUM_PLAYERS + player; i++) {
-//            strcpy(currView->messages[i], messages[i]);
-//        }
-//    } else {
-//        //initialise messages to NULL if it's empty
-//        currView->messages = NULL;
-//    }
-
-    //fill in info for each player
+    currView->pastPlays[0] = '\0';
+    currView->nChars = 0;
+    currView->nTurns = 0;
+
+    currView->gameScore = GAME_START_SCORE;
+    currView->roundNumber = 0;
+    currView->currentPlayer = PLAYER_LORD_GODALMING;
+    //messages are not kept, nothing asks for them
+
+    //start every player off before their first play
     for (player = PLAYER_LORD_GODALMING; player < NUM_PLAYERS; player++) {
         currView->players[player] = malloc(sizeof(playerInfo));
         assert(currView->players[player] != NULL);
-        currView->players[player]->playerHealth = getHealth(currView, player);
-        currView->players[player]->playerCurrLocation = getLocation(currView, player);
-        getHistory(currView, player, currView->players[player]->playerTrail);
+        if (player == PLAYER_DRACULA) {
+            currView->players[player]->playerHealth = GAME_START_BLOOD_POINTS;
+        } else {
+            currView->players[player]->playerHealth = GAME_START_HUNTER_LIFE_POINTS;
+        }
+        currView->players[player]->playerCurrLocation = NOWHERE;
+        currView->players[player]->diedLastTurn = FALSE;
+        initialiseTrail(currView->players[player]->playerTrail);
     }
+    initialiseTrail(currView->dracTrail);
+    memset(currView->numTraps, 0, sizeof(currView->numTraps));
+    memset(currView->numVamps, 0, sizeof(currView->numVamps));
+
+    //read the whole history in one go
+    appendPlays(currView, pastPlays, messages);
     return currView;
 }
 
+// Advances the GameView by the plays made since it was created or last advanced
+void appendPlays(GameView currentView, char *newPlays, PlayerMessage messages[]) {
+    assert(currentView != NULL && newPlays != NULL);
+
+    int i, nNew;
+
+    //spaces at either end are left out, so pastPlays always has just one
+    // between plays (DracBelief reads it that way)
+    while (*newPlays == ' ') newPlays++;
+    nNew = countChar(newPlays);
+    while (nNew > 0 && newPlays[nNew - 1] == ' ') nNew--;
+    if (nNew == 0) return;
+
+    //make room for a separating space, the new plays and the '\0'
+    if (currentView->nChars + nNew + 2 > currentView->maxChars) {
+        while (currentView->nChars + nNew + 2 > currentView->maxChars) {
+            currentView->maxChars *= 2;
+        }
+        currentView->pastPlays = realloc(currentView->pastPlays,
+                                         currentView->maxChars * sizeof(char));
+        assert(currentView->pastPlays != NULL);
+    }
+
+    //each play updates the state of the player who made it
+    for (i = 0; i + CHARS_PER_TURN - 1 <= nNew; i += CHARS_PER_TURN) {
+        readPlay(currentView, &newPlays[i]);
+    }
+
+    if (currentView->nChars > 0) {
+        currentView->pastPlays[currentView->nChars] = ' ';
+        currentView->nChars++;
+    }
+    memcpy(&currentView->pastPlays[currentView->nChars], newPlays, nNew);
+    currentView->nChars += nNew;
+    currentView->pastPlays[currentView->nChars] = '\0';
+}
+
+// Updates the game state by a single play
+static void readPlay(GameView currentView, char *play) {
+    PlayerID player = currentView->nTurns % NUM_PLAYERS;
+    playerInfo *info = currentView->players[player];
+    playerInfo *dracula = currentView->players[PLAYER_DRACULA];
+    LocationID prevLocation = info->playerTrail[0];
+    LocationID currID;
+    int i;
+
+    if (player == PLAYER_DRACULA) {
+        //the place that is about to fall off the end of the trail
+        LocationID fallOffLoc = currentView->dracTrail[TRAIL_SIZE - 1];
+
+        //the history keeps what was played, hides and double backs included,
+        // the other trail follows where Dracula actually is
+        updatePlayerTrail(info->playerTrail, play, PLAYER_LORD_GODALMING);
+        updatePlayerTrail(currentView->dracTrail, play, PLAYER_DRACULA);
+        currID = currentView->dracTrail[0];
+
+        if (currID == SEA_UNKNOWN || (validPlace(currID) && idToType(currID) == SEA)) {
+            info->playerHealth -= LIFE_LOSS_SEA;
+        } else if (currID == CASTLE_DRACULA) {
+            info->playerHealth += LIFE_GAIN_CASTLE_DRACULA;
+        }
+
+        //the encounter left by the turn that fell off the trail is gone
+        // (only that one: he may have been back there since)
+        if (validPlace(fallOffLoc)) {
+            if (play[5] == 'M') removeMinion(&currentView->numTraps[fallOffLoc]);
+            if (play[5] == 'V') removeMinion(&currentView->numVamps[fallOffLoc]);
+        }
+        if (validPlace(currID)) {
+            if (play[3] == 'T') currentView->numTraps[currID]++;
+            if (play[4] == 'V') currentView->numVamps[currID]++;
+        }
+
+        if (play[5] == 'V') currentView->gameScore -= SCORE_LOSS_VAMPIRE_MATURES;
+        currentView->gameScore -= SCORE_LOSS_DRACULA_TURN;
+        //Dracula's location is where he really is (as far as it is known)
+        info->playerCurrLocation = currID;
+    } else {
+        updatePlayerTrail(info->playerTrail, play, player);
+        currID = info->playerTrail[0];
+        info->playerHealth = hunterTurnHealth(play, info->playerHealth,
+                                              prevLocation, currID);
+
+        //the hunter sets off or meets whatever is left there
+        for (i = 0; i < NUM_EVENT_ENCOUNTER; i++) {
+            switch (play[3 + i]) {
+                case 'T': removeMinion(&currentView->numTraps[currID]); break;
+                case 'V': removeMinion(&currentView->numVamps[currID]); break;
+                case 'D': dracula->playerHealth -= LIFE_LOSS_HUNTER_ENCOUNTER; break;
+                default: break;
+            }
+        }
+
+        //a hunter who dies is taken to the hospital with full health
+        info->diedLastTurn = (info->playerHealth <= 0);
+        if (info->diedLastTurn) {
+            info->playerHealth = GAME_START_HUNTER_LIFE_POINTS;
+            currentView->gameScore -= SCORE_LOSS_HUNTER_HOSPITAL;
+            info->playerCurrLocation = ST_JOSEPH_AND_ST_MARYS;
+        } else {
+            info->playerCurrLocation = currID;
+        }
+    }
+
+    currentView->nTurns++;
+    currentView->roundNumber = currentView->nTurns / NUM_PLAYERS;
+    currentView->currentPlayer = currentView->nTurns % NUM_PLAYERS;
+}
+
+// Takes away a trap or vampire that has gone from a place
+// (the hunters never see one placed where Dracula was hidden from them,
+//  so when they meet it there it was never counted and stays at 0)
+static void removeMinion(int *count) {
+    if (*count > 0) (*count)--;
+}
+
 // Frees all memory previously allocated for the GameView toBeDeleted
 void disposeGameView(GameView toBeDeleted) {
     assert(toBeDeleted != NULL);
@@ -64,8 +189,6 @@ void disposeGameView(GameView toBeDeleted) {
         free(toBeDeleted->players[player]);
         toBeDeleted->players[player] = NULL;
     }
-//    if (toBeDeleted->messages != NULL) free(toBeDeleted->messages);
-//    toBeDeleted->messages = NULL;
     if (toBeDeleted->pastPlays != NULL) free(toBeDeleted->pastPlays);
     toBeDeleted->pastPlays = NULL;
     free(toBeDeleted);
@@ -73,195 +196,53 @@ void disposeGameView(GameView toBeDeleted) {
 }
 
 //// Functions to return simple information about the current state of the game
+//// (all of it is worked out as the plays are read)
 // Get the current round
 Round getRound(GameView currentView) {
     assert(currentView != NULL);
-
-    Round round;        //current round to be returned
-    int nChar = countChar(currentView->pastPlays);
-
-    if (nChar < CHARS_PER_ROUND - 1) {
-        round = 0;
-    } else {
-        round = ((nChar - 39)/CHARS_PER_ROUND) + 1;
-    }
-    return round;
+    return currentView->roundNumber;
 }
 
 // Get the id of current player - ie whose turn is it?
 PlayerID getCurrentPlayer(GameView currentView) {
     assert(currentView != NULL);
-
-    PlayerID currentPlayer;    //current player ID to be returned
-    int nChar = countChar(currentView->pastPlays);
-
-    //number of plays % number of player gives
-    // the remainder equal to player ID
-    currentPlayer = ((nChar + 1)/CHARS_PER_TURN) % NUM_PLAYERS;
-    return currentPlayer;
+    return currentView->currentPlayer;
 }
 
 // Get the current score
 int getScore(GameView currentView) {
     assert(currentView != NULL);
-
-    int score = GAME_START_SCORE;    //the current score to be returned
-    //number of times Dracula finishes a turn
-    int dracTurnCount = 0;
-    //number of times a Vampire matures
-    int matureCount = 0;
-    //number of times a hunter is teleported to the hospital
-    int teleportCount = 0;
-    //hunters' health in each round
-    int health = GAME_START_HUNTER_LIFE_POINTS;
-    //hunters' previous location in each round
-    LocationID prevLocation = UNKNOWN_LOCATION;
-    //index place of first move of player in pastPlays
-    int firstMove;
-    int i = 0;
-    PlayerID player;
-    Round round = getRound(currentView);
-    int nChar = countChar(currentView->pastPlays);
-
-    //count the number of times a hunter is teleported to the hospital
-    for (player = PLAYER_LORD_GODALMING; player <= PLAYER_MINA_HARKER; player++) {
-        firstMove = player * CHARS_PER_TURN;
-        //loop each time a hunter has played
-        for (i = firstMove; i < nChar - 2; i += CHARS_PER_ROUND) {
-            //hunters' current location in each turn
-            char currLocation[3];
-            strToAbbrev(&currentView->pastPlays[i], currLocation);
-            health = hunterTurnHealth(&currentView->pastPlays[i],
-                                      health, prevLocation,
-                                      abbrevToID(currLocation));
-            prevLocation = abbrevToID(currLocation);
-            if (health <= 0) {
-                //reset the life points to max when the hunter had died
-                health = GAME_START_HUNTER_LIFE_POINTS;
-                teleportCount++;
-            }
-        }
-    }
-
-    //count the number of times Dracula finishes a turn
-    if ((countChar(currentView->pastPlays) + 1) % CHARS_PER_ROUND == 0) {
-        //if the round has just finished (ie, Dracula just finished his move)
-        dracTurnCount = round + 1;
-    } else {
-        //the round is still running
-        // (ie, Dracula hasn't finished his move in that round yet)
-        dracTurnCount = round;
-    }
-
-    //count the number of times a Vampire matures
-    firstMove = PLAYER_DRACULA * CHARS_PER_TURN;
-    for (i = firstMove; i < nChar; i += CHARS_PER_ROUND) {
-        if (currentView->pastPlays[i+5] == 'V') {
-            matureCount++;
-        }
-    }
-
-    //calculate the final score
-    score -= (teleportCount * SCORE_LOSS_HUNTER_HOSPITAL +
-              dracTurnCount * SCORE_LOSS_DRACULA_TURN +
-              matureCount * SCORE_LOSS_VAMPIRE_MATURES);
-    assert(score <= GAME_START_SCORE);
-    return score;
+    assert(currentView->gameScore <= GAME_START_SCORE);
+    return currentView->gameScore;
 }
 
+// Get the current health points for a given player
 int getHealth(GameView currentView, PlayerID player) {
     assert(currentView != NULL);
     assert(player >= PLAYER_LORD_GODALMING && player < NUM_PLAYERS);
-
-    //hunters' previous location in each turn
-    LocationID prevLocation = UNKNOWN_LOCATION;
-    //index place of first move of player in pastPlays
-    int firstMove = player * CHARS_PER_TURN;
-    LocationID currID;                //current location
-    int health = 0;
-    Round round = getRound(currentView);
-    int nChar = countChar(currentView->pastPlays);
-    int i, entCount;
-
-    //health calculation for dracula
-    if (player == PLAYER_DRACULA) {
-        health = GAME_START_BLOOD_POINTS;
-        if (round == 0) return health;
-
-        initialiseTrail(currentView->players[player]->playerTrail);
-        //loop each time dracula has played
-        for (i = firstMove; i < nChar - 2; i += CHARS_PER_ROUND) {
-            int type = NONE;
-            updatePlayerTrail(currentView->players[player]->playerTrail,
-                              &currentView->pastPlays[i], PLAYER_DRACULA);
-            currID = currentView->players[player]->playerTrail[0];
-            if (validPlace(currID))
-            type = idToType(currID);
-            if (currID == SEA_UNKNOWN || type == SEA) {
-                health -= LIFE_LOSS_SEA;
-            } else if (currID == TELEPORT || currID == CASTLE_DRACULA) {
-                health += LIFE_GAIN_CASTLE_DRACULA;
-            }
-        }
-        //loop each time a player has played
-        for (i = 3; i < nChar; i += CHARS_PER_TURN) {
-            //loop through the events a hunter encountered in each play
-            for (entCount = 0; entCount < NUM_EVENT_ENCOUNTER; entCount++) {
-                if (currentView->pastPlays[i + entCount] == 'D') {
-                    health -= LIFE_LOSS_HUNTER_ENCOUNTER;
-                }
-            }
-        }
-    } else {
-        //health calculation for hunters
-        health = GAME_START_HUNTER_LIFE_POINTS;
-        if (round == 0) return health;
-
-        //loop each time a hunter has played
-        for (i = firstMove; i < nChar; i += CHARS_PER_ROUND) {
-            char currLocation[3];
-            strToAbbrev(&currentView->pastPlays[i], currLocation);
-            health = hunterTurnHealth(&currentView->pastPlays[i],
-                                      health, prevLocation,
-                                      abbrevToID(currLocation));
-            prevLocation = abbrevToID(currLocation);
-            if (health <= 0) {
-                //reset hunters' health if he has died
-                health = GAME_START_HUNTER_LIFE_POINTS;
-            }
-        }
-        assert(health <= GAME_START_HUNTER_LIFE_POINTS);
-    }
-    return health;
+    return currentView->players[player]->playerHealth;
 }
 
 // Get the current location id of a given player
 LocationID getLocation(GameView currentView, PlayerID player) {
     assert(currentView != NULL);
     assert(player >= PLAYER_LORD_GODALMING && player < NUM_PLAYERS);
+    //Dracula's move as it was played, hides and double backs included
+    if (player == PLAYER_DRACULA) return currentView->players[player]->playerTrail[0];
+    return currentView->players[player]->playerCurrLocation;
+}
 
-    int nChar = countChar(currentView->pastPlays);
-    //player has not had a turn yet
-    if (nChar <= player * CHARS_PER_TURN) return NOWHERE;
-
-    getHistory(currentView, player,
-               currentView->players[player]->playerTrail);
-
-	if (getHealth(currentView,player) == 9 && getRound(currentView) > 1 && player != PLAYER_DRACULA) {
-    	LocationID curr = getCurrentPlayer(currentView);
-    	int offset = 0;
-
-    	if (curr > player)
-			offset = -(curr-player)*CHARS_PER_TURN;
-    	else
-			offset = -(5-player+curr)*CHARS_PER_TURN;
+// Find out how many traps and immature vampires are at a given place
+void getMinions(GameView currentView, LocationID where,
+                int *numTraps, int *numVamps) {
+    assert(currentView != NULL);
+    assert(validPlace(where) || where == NOWHERE);
 
-    	offset += nChar+1;
-    	int health = hunterTurnHealth(&currentView->pastPlays[offset],1,
-		currentView->players[player]->playerTrail[1],currentView->players[player]->playerTrail[0]);
-		if (health <= 0) return ST_JOSEPH_AND_ST_MARYS;
-	}
-    return currentView->players[player]->playerTrail[0];
+    *numTraps = 0;
+    *numVamps = 0;
+    if (where == NOWHERE || idToType(where) == SEA) return;
+    *numTraps = currentView->numTraps[where];
+    *numVamps = currentView->numVamps[where];
 }
 
 //// Functions that return information about the history of the game
@@ -271,17 +252,9 @@ void getHistory(GameView currentView, PlayerID player,
     assert(currentView != NULL);
     assert(player >= PLAYER_LORD_GODALMING && player < NUM_PLAYERS);
 
-    int i = 0;
-    int firstMove = player * CHARS_PER_TURN;    //index of first move
-    int nChar = countChar(currentView->pastPlays);
-
-    initialiseTrail(trail);
-    //don't give the actual location of Dracula,
-    // so never pass in Dracula ID to updatePlayerTrail
-    if (player == PLAYER_DRACULA) player --;
-    //loop till the last round
-    for (i = firstMove; i < nChar - 2; i += CHARS_PER_ROUND) {
-        updatePlayerTrail(trail, &currentView->pastPlays[i], player);
+    int i;
+    for (i = 0; i < TRAIL_SIZE; i++) {
+        trail[i] = currentView->players[player]->playerTrail[i];
     }
 }
 
@@ -291,107 +264,86 @@ LocationID *connectedLocations(int *numLocations,
                                LocationID from, PlayerID player, Round round,
                                int road, int rail, int sea)
 {
+    TRACE_SCOPE(TRACE_CONNECTED_LOCATIONS);
+    LocationID connections[NUM_MAP_LOCATIONS];
+    LocationID *result;
+
+    *numLocations = fillConnectedLocations(connections, from, player, round,
+                                           road, rail, sea);
+    result = malloc((*numLocations) * sizeof(LocationID));
+    assert(result != NULL);
+    memcpy(result, connections, (*numLocations) * sizeof(LocationID));
+    return result;
+}
+
+// Stores the directly connected locations in the connections array
+//  and returns how many there are, without allocating anything
+int fillConnectedLocations(LocationID connections[NUM_MAP_LOCATIONS],
+                           LocationID from, PlayerID player, Round round,
+                           int road, int rail, int sea)
+{
+    TRACE_SCOPE(TRACE_FILL_CONNECTED);
     assert(from >= MIN_MAP_LOCATION && from <= MAX_MAP_LOCATION);
     assert(player >= PLAYER_LORD_GODALMING && player < NUM_PLAYERS);
     assert(round >= 0);
 
-    *numLocations = 1;        //initialise the array size
-    LocationID *connections = malloc((*numLocations) * sizeof(LocationID));
-    assert(connections != NULL);
-    connections[0] = from;    //initialise the array
-    Map map = newGraph();       //get the game map
-    int i, j;
+    Map map = sharedMap(FULL_GRAPH);    //get the game map
+    LocSet added = singletonSet(from);  //locations already in the array
+    int numLocations = 0;
+    EdgeIter it;
+    LocationID to;
+    TransportID type;
+
+    connections[numLocations++] = from;    //initialise the array
 
     //find the nearby cities of type ROAD
+    // (Dracula can't move to hospital)
     if (road) {
-        connections = NearbyCities(map, from, connections, numLocations, ROAD);
-        //case: Dracula can't move to hospital
-        // delete the location of hospital if it is in the connections array
-        if (player == PLAYER_DRACULA &&
-            inArray(connections, ST_JOSEPH_AND_ST_MARYS, *numLocations) != -1) {
-            for (i = 0; i < *numLocations; i++) {
-                if (connections[i] == ST_JOSEPH_AND_ST_MARYS) {
-                    for (j = i; j + 1 < *numLocations; j++) {
-                        connections[j] = connections[j + 1];
-                    }
-                    i = *numLocations;
-                }
-            }
-            //reset the size of array
-            (*numLocations)--;
-            if ((*numLocations) > 0) {
-                connections = realloc(connections, (*numLocations) * sizeof(LocationID));
-                assert(connections != NULL);
-            } else {
-                connections = NULL;
-            }
+        for (startEdges(map, from, &it); nextEdge(&it, &to, &type); ) {
+            if (type != ROAD || inSet(added, to)) continue;
+            if (player == PLAYER_DRACULA && to == ST_JOSEPH_AND_ST_MARYS) continue;
+            connections[numLocations++] = to;
+            addToSet(&added, to);
         }
     }
 
     //find the nearby cities of type BOAT
     if (sea) {
-        connections = NearbyCities(map, from, connections, numLocations, BOAT);
+        for (startEdges(map, from, &it); nextEdge(&it, &to, &type); ) {
+            if (type != BOAT || inSet(added, to)) continue;
+            connections[numLocations++] = to;
+            addToSet(&added, to);
+        }
     }
 
     //find the nearby cities of type RAIL
-    if (rail) {
+    // (not worth looking if there is no station here)
+    if (rail && player != PLAYER_DRACULA && numConnections(from, RAIL) > 0) {
         //number of stations that is allowed to pass through
         int stationsAllowed = (player + round) % 4;
-        //number of next stations
-        int priNumStations = 0;
-        //number of stations next to the "next next stations"
-        int secNumStations = 0;
-        //number elements(stations) in railConnections array
-        int numStations = 1;
-        //array of connected rail stations
-        LocationID *railConnections = malloc(numStations * sizeof(LocationID));
-        assert(railConnections != NULL);
-        railConnections[0] = from;
-
-        if (player == PLAYER_DRACULA || stationsAllowed == 0)
-            return connections;
-
-        //get the primary rail connections from the given location
-        connections = NearbyCities(map, from, connections, numLocations, RAIL);
-        if (stationsAllowed == 1) return connections;
-
-        //get the primary rail connections and
-        // store it into the railConnections array
-        railConnections = NearbyCities(map, from, railConnections,
-                                       &numStations, RAIL);
-        priNumStations = numStations;
-        //loop through the primary rail stations and find their nearby rail stations
-        for (i = 0; i < priNumStations; i++) {
-            railConnections = NearbyCities(map, railConnections[i],
-                                           railConnections, &numStations, RAIL);
-        }
-
-        if (stationsAllowed == 3) {
-            secNumStations = numStations;
-            //loop through only the secondary rail stations and
-            // find their nearby rail stations
-            for (i = priNumStations - 1; i < secNumStations; i++) {
-                railConnections = NearbyCities(map, railConnections[i],
-                                               railConnections, &numStations, RAIL);
-            }
-        }
-
-        //put the nearby cities of type RAIL to
-        // the connections array without duplicates
-        for (i = 0; i < numStations; i++) {
-            for (j = 0; j < *numLocations; j++) {
-                if (connections[j] == railConnections[i]) j = *numLocations;
-            }
-            //only the "new" locations are added to the connections array
-            if (j != (*numLocations) + 1) {
-                (*numLocations)++;
-                connections = realloc(connections,
-                                      *numLocations * sizeof(LocationID));
-                assert(connections != NULL);
-                connections[*numLocations - 1] = railConnections[i];
+        //stations reached so far, in the order they were reached
+        LocationID stations[NUM_MAP_LOCATIONS];
+        LocSet onLine = singletonSet(from);
+        int numStations = 0, first = 0, last, depth, i;
+
+        stations[numStations++] = from;
+        //go one more stop down every line each time round
+        for (depth = 0; depth < stationsAllowed; depth++) {
+            last = numStations;
+            for (i = first; i < last; i++) {
+                for (startEdges(map, stations[i], &it); nextEdge(&it, &to, &type); ) {
+                    if (type != RAIL || inSet(onLine, to)) continue;
+                    stations[numStations++] = to;
+                    addToSet(&onLine, to);
+                    //only the "new" locations are added to the connections array
+                    if (!inSet(added, to)) {
+                        connections[numLocations++] = to;
+                        addToSet(&added, to);
+                    }
+                }
             }
+            first = last;
         }
-        free(railConnections);
     }
-    return connections;
+    return numLocations;
 }
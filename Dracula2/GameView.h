@@ -33,6 +33,14 @@ GameView newGameView(char *pastPlays, PlayerMessage messages[]);
 
 void disposeGameView(GameView toBeDeleted);
 
+// appendPlays() advances an existing game view by the plays made since it
+// was created (or last advanced), without reading the earlier history again.
+//
+// newPlays is in the same format as pastPlays and holds only the new plays,
+// starting with the play after the last one the view has seen.
+// messages holds a playerMessage for each of the new plays, as above.
+void appendPlays(GameView currentView, char *newPlays, PlayerMessage messages[]);
+
 
 // Functions to return simple information about the current state of the game
 
@@ -79,6 +87,13 @@ int getHealth(GameView currentView, PlayerID player);
 
 LocationID getLocation(GameView currentView, PlayerID player);
 
+// Find out how many traps and immature vampires are at a given place
+// Both are 0 for seas and NOWHERE
+// Hunters only see what Dracula has revealed, so for them this only counts
+//   minions placed where Dracula's location was known
+void getMinions(GameView currentView, LocationID where,
+                int *numTraps, int *numVamps);
+
 
 //// Functions that return information about the history of the game
 
@@ -122,4 +137,11 @@ LocationID *connectedLocations(int *numLocations,
                                LocationID from, PlayerID player, Round round,
                                int road, int rail, int sea);
 
+// fillConnectedLocations() is the same as connectedLocations() but stores
+//   the locations in the given array (which needs room for every location)
+//   and returns how many there are, so nothing has to be allocated or freed
+int fillConnectedLocations(LocationID connections[NUM_MAP_LOCATIONS],
+                           LocationID from, PlayerID player, Round round,
+                           int road, int rail, int sea);
+
 #endif
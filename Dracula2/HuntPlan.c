@@ -0,0 +1,66 @@
+// HuntPlan.c ... sending the hunters to target places together
+
+#include <assert.h>
+#include <string.h>
+#include "HuntPlan.h"
+#include "Distances.h"
+
+// turns counted for a place a hunter can't get to at all
+#define FAR_AWAY  NUM_MAP_LOCATIONS
+
+void makeHuntPlan(HuntPlan *plan, Round round, PlayerID player,
+                  LocationID trail[TRAIL_SIZE],
+                  LocationID hunters[PLAYER_DRACULA],
+                  LocationID *targets, int nTargets)
+{
+    int turns[PLAYER_DRACULA][PLAYER_DRACULA];
+    int choice[PLAYER_DRACULA];
+    int hunter, t, ways, way, code, covered, latest, total;
+    int bestLatest = -1, bestTotal = 0, bestWay = 0;
+
+    assert(nTargets >= 1 && nTargets <= PLAYER_DRACULA);
+    for (hunter = 0; hunter < PLAYER_DRACULA; hunter++) {
+        for (t = 0; t < nTargets; t++) {
+            assert(validPlace(targets[t]));
+            turns[hunter][t] = validPlace(hunters[hunter]) ?
+                shortestDistance(hunters[hunter], targets[t], hunter,
+                                 round + (hunter < player), BY_ANY) : NO_PATH;
+            if (turns[hunter][t] == NO_PATH) turns[hunter][t] = FAR_AWAY;
+        }
+    }
+
+    // way is a number in base nTargets, one digit for each hunter's target
+    for (ways = 1, hunter = 0; hunter < PLAYER_DRACULA; hunter++) ways *= nTargets;
+    for (way = 0; way < ways; way++) {
+        covered = latest = total = 0;
+        for (code = way, hunter = 0; hunter < PLAYER_DRACULA; hunter++, code /= nTargets) {
+            t = code % nTargets;
+            covered |= 1 << t;
+            if (turns[hunter][t] > latest) latest = turns[hunter][t];
+            total += turns[hunter][t];
+        }
+        if (covered != (1 << nTargets) - 1) continue;
+        if (bestLatest < 0 || latest < bestLatest ||
+            (latest == bestLatest && total < bestTotal)) {
+            bestLatest = latest;
+            bestTotal = total;
+            bestWay = way;
+        }
+    }
+
+    for (code = bestWay, hunter = 0; hunter < PLAYER_DRACULA; hunter++, code /= nTargets) {
+        choice[hunter] = code % nTargets;
+        plan->target[hunter] = targets[choice[hunter]];
+        plan->arrival[hunter] = turns[hunter][choice[hunter]];
+    }
+    plan->latest = bestLatest;
+    plan->round = round;
+    memcpy(plan->trail, trail, sizeof(plan->trail));
+    plan->nTargets = nTargets;
+}
+
+int huntPlanIsCurrent(HuntPlan *plan, Round round, LocationID trail[TRAIL_SIZE])
+{
+    return plan->nTargets > 0 && plan->round == round &&
+           memcmp(plan->trail, trail, sizeof(plan->trail)) == 0;
+}
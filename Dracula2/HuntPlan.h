@@ -0,0 +1,44 @@
+// HuntPlan.h ... which hunter heads for which place, decided for all four
+//
+// Left to themselves the hunters each pick a place to go to by their
+// player number, so two can end up crossing the map to places the other
+// was next to. A HuntPlan instead sends each hunter to one of a few
+// target places (every target gets at least one hunter) so that the last
+// of them to arrive gets there as soon as possible, and among those
+// choices the fewest turns are spent altogether. The turns come straight
+// from the distance tables, and with at most four targets there are only
+// 256 ways to try.
+//
+// Everything a plan is made from is known as soon as Dracula has moved,
+// so one plan does for every hunter that round: a plan keeps the round
+// and the trail it was made for, and huntPlanIsCurrent() says whether it
+// can be used again instead of being made afresh.
+
+#ifndef HUNTPLAN_H
+#define HUNTPLAN_H
+
+#include "Globals.h"
+#include "Places.h"
+
+typedef struct huntPlan {
+    LocationID target[PLAYER_DRACULA];    // where each hunter is heading
+    int arrival[PLAYER_DRACULA];          // turns each needs to get there
+    int latest;                           // the most of those
+    Round round;                          // the round the plan was made for
+    LocationID trail[TRAIL_SIZE];         // Dracula's trail it was made from
+    int nTargets;                         // 0 until a plan has been made
+                                          //  (so a plan set to all 0s is empty)
+} HuntPlan;
+
+// make a plan for the hunters at hunters[0 ... 3] to cover targets[0 ...
+//  nTargets - 1] (1 to 4 places, no repeats), made in the given round when
+//  it is player's turn (so the hunters before player move next round)
+void makeHuntPlan(HuntPlan *plan, Round round, PlayerID player,
+                  LocationID trail[TRAIL_SIZE],
+                  LocationID hunters[PLAYER_DRACULA],
+                  LocationID *targets, int nTargets);
+
+// whether plan was made this round from the same trail of Dracula's
+int huntPlanIsCurrent(HuntPlan *plan, Round round, LocationID trail[TRAIL_SIZE]);
+
+#endif
@@ -8,18 +8,75 @@
 #include "HunterView.h"
 #include "commonFunctions.h"
 
+typedef struct _encounterData {
+    int trailPos;           // newest place in Dracula's trail it is at, or -1
+    LocationID move;        // the move made there (the place, HIDE or DOUBLE_BACK_n)
+} encounterData;
+
 struct hunterView {
     GameView view;
+    encounterData places[NUM_MAP_LOCATIONS];    // what the hunters know of every place
+    int specialMoves;       // hasDBOrHI() of Dracula's trail
+    int dbPos;              // posOfDb() of Dracula's trail
+    DracBelief belief;      // where Dracula might be, moved on a play at a time
+    int haveBelief;         // whether belief has been worked out yet
 };
 
+// Fills in the encounter table from Dracula's trail as the hunters see it,
+//   following hides and double backs back to a revealed place
+static void updateTrail(HunterView hunterView) {
+    int i;
+    LocationID where;
+    LocationID trail[TRAIL_SIZE];
+    LocationID resolved[TRAIL_SIZE];
+
+    for (where = MIN_MAP_LOCATION; where <= MAX_MAP_LOCATION; where++) {
+        hunterView->places[where].trailPos = -1;
+        hunterView->places[where].move = NOWHERE;
+    }
+    getHistory(hunterView->view, PLAYER_DRACULA, trail);
+    // oldest first, so a hide or double back can look at older entries
+    //  and a place he has been to twice keeps the newest
+    for (i = TRAIL_SIZE - 1; i >= 0; i--) {
+        if (trail[i] == HIDE) {
+            resolved[i] = (i + 1 < TRAIL_SIZE) ? resolved[i + 1] : NOWHERE;
+        } else if (trail[i] >= DOUBLE_BACK_1 && trail[i] <= DOUBLE_BACK_5) {
+            where = i + trail[i] - DOUBLE_BACK_1 + 1;
+            resolved[i] = (where < TRAIL_SIZE) ? resolved[where] : NOWHERE;
+        } else if (trail[i] == TELEPORT) {
+            resolved[i] = CASTLE_DRACULA;
+        } else {
+            resolved[i] = trail[i];
+        }
+        if (!validPlace(resolved[i])) continue;
+        hunterView->places[resolved[i]].trailPos = i;
+        hunterView->places[resolved[i]].move = trail[i];
+    }
+    hunterView->specialMoves = hasDBOrHI(trail);
+    hunterView->dbPos = posOfDb(trail);
+}
+
 // Creates a new HunterView to summarise the current state of the game
 HunterView newHunterView(char *pastPlays, PlayerMessage messages[]) {
     HunterView hunterView = malloc(sizeof(struct hunterView));
     assert(hunterView != NULL);
     hunterView->view = newGameView(pastPlays, messages);
+    updateTrail(hunterView);
+    hunterView->haveBelief = FALSE;
     return hunterView;
 }
 
+// Advances the HunterView by the plays made since it was created or last advanced
+void appendHunterPlays(HunterView currentView, char *newPlays, PlayerMessage messages[]) {
+    PlayerID player;
+
+    assert(currentView != NULL && currentView->view != NULL);
+    player = currentView->view->currentPlayer;
+    appendPlays(currentView->view, newPlays, messages);
+    updateTrail(currentView);
+    if (currentView->haveBelief) beliefAddPlays(&currentView->belief, newPlays, player);
+}
+
 // Frees all memory previously allocated for the HunterView toBeDeleted
 void disposeHunterView(HunterView toBeDeleted) {
     assert(toBeDeleted != NULL);
@@ -73,6 +130,34 @@ void giveMeTheTrail(HunterView currentView, PlayerID player,
     return;
 }
 
+// How many turns ago Dracula was last seen at where, or -1 if he wasn't
+int trailPosition(HunterView currentView, LocationID where) {
+    assert(currentView != NULL && currentView->view != NULL);
+    assert(validPlace(where) || where == NOWHERE);
+    if (!validPlace(where)) return -1;
+    return currentView->places[where].trailPos;
+}
+
+// The move Dracula made to get to where, or NOWHERE if he wasn't seen there
+LocationID trailMove(HunterView currentView, LocationID where) {
+    assert(currentView != NULL && currentView->view != NULL);
+    assert(validPlace(where) || where == NOWHERE);
+    if (!validPlace(where)) return NOWHERE;
+    return currentView->places[where].move;
+}
+
+// Whether there is a hide and/or a double back in Dracula's trail
+int specialMovesInTrail(HunterView currentView) {
+    assert(currentView != NULL && currentView->view != NULL);
+    return currentView->specialMoves;
+}
+
+// Where the double back in Dracula's trail is, or -1 if there isn't one
+int doubleBackPosition(HunterView currentView) {
+    assert(currentView != NULL && currentView->view != NULL);
+    return currentView->dbPos;
+}
+
 //// Functions that query the map to find information about connectivity
 
 // What are my possible next moves (locations)
@@ -94,3 +179,42 @@ LocationID *whereCanTheyGo(HunterView currentView, int *numLocations,
                               player, giveMeTheRound(currentView), 
                               road, rail, sea);
 }
+
+// What are my possible next moves (stored in moves, returns how many)
+int fillWhereCanIgo(HunterView currentView, LocationID moves[NUM_MAP_LOCATIONS],
+                    int road, int rail, int sea) {
+    assert(currentView != NULL && currentView->view != NULL);
+    PlayerID player = whoAmI(currentView);    // get the current player
+    return fillConnectedLocations(moves, whereIs(currentView, player),
+                                  player, giveMeTheRound(currentView),
+                                  road, rail, sea);
+}
+
+// What are the specified player's next possible moves
+// (stored in moves, returns how many)
+int fillWhereCanTheyGo(HunterView currentView, LocationID moves[NUM_MAP_LOCATIONS],
+                       PlayerID player, int road, int rail, int sea) {
+    assert(currentView != NULL && currentView->view != NULL);
+    assert(player >= PLAYER_LORD_GODALMING && player < NUM_PLAYERS);
+    return fillConnectedLocations(moves, whereIs(currentView, player),
+                                  player, giveMeTheRound(currentView),
+                                  road, rail, sea);
+}
+
+// Fill in a GameState with the current state of the game
+void hunterViewToState(HunterView currentView, GameState *state) {
+    assert(currentView != NULL && currentView->view != NULL);
+    viewToState(currentView->view, state);
+}
+
+// How likely Dracula is to be at each place now
+void whereMightDraculaBe(HunterView currentView, DracBelief *belief) {
+    assert(currentView != NULL && currentView->view != NULL);
+    // worked out from all the plays the first time, and after that moved
+    //  on with each appendHunterPlays()
+    if (!currentView->haveBelief) {
+        beliefFromPlays(&currentView->belief, currentView->view->pastPlays);
+        currentView->haveBelief = TRUE;
+    }
+    *belief = currentView->belief;
+}
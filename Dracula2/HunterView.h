@@ -8,6 +8,8 @@
 #include "Globals.h"
 #include "Game.h"
 #include "Places.h"
+#include "GameState.h"
+#include "DracBelief.h"
 
 typedef struct hunterView *HunterView;
 
@@ -32,6 +34,13 @@ typedef struct hunterView *HunterView;
 HunterView newHunterView(char *pastPlays, PlayerMessage messages[]);
 
 
+// appendHunterPlays() advances an existing HunterView by the plays made since it
+// was created (or last advanced), like appendPlays() does for a GameView,
+// so an AI that stays running between turns only reads each play once.
+
+void appendHunterPlays(HunterView currentView, char *newPlays, PlayerMessage messages[]);
+
+
 // disposeHunterView() frees all memory previously allocated for the HunterView
 // toBeDeleted. toBeDeleted should not be accessed after the call.
 
@@ -86,6 +95,21 @@ LocationID whereIs(HunterView currentView, PlayerID player);
 void giveMeTheTrail(HunterView currentView, PlayerID player,
                         LocationID trail[TRAIL_SIZE]);
 
+// The encounter table: everything below is worked out once when the view
+//   is made (or advanced), so each question is a single lookup
+// trailPosition() gives how many turns ago Dracula was last known to be
+//   at where (0 is now), following hides and double backs to the place
+//   they repeat, or -1 if where is not known to be in his trail
+// trailMove() gives the move he made to get there: where itself, HIDE,
+//   DOUBLE_BACK_n or TELEPORT, or NOWHERE as above
+// specialMovesInTrail() and doubleBackPosition() are what hasDBOrHI() and
+//   posOfDb() say about his trail
+
+int trailPosition(HunterView currentView, LocationID where);
+LocationID trailMove(HunterView currentView, LocationID where);
+int specialMovesInTrail(HunterView currentView);
+int doubleBackPosition(HunterView currentView);
+
 
 //// Functions that query the map to find information about connectivity
 
@@ -113,5 +137,26 @@ LocationID *whereCanIgo(HunterView currentView, int *numLocations,
 LocationID *whereCanTheyGo(HunterView currentView, int *numLocations,
                            PlayerID player, int road, int rail, int sea);
 
+// fillWhereCanIgo() and fillWhereCanTheyGo() give the same locations as
+//   whereCanIgo() and whereCanTheyGo() but store them in the moves array
+//   (which needs room for every location) and return how many there are,
+//   so nothing has to be allocated or freed
+
+int fillWhereCanIgo(HunterView currentView, LocationID moves[NUM_MAP_LOCATIONS],
+                    int road, int rail, int sea);
+int fillWhereCanTheyGo(HunterView currentView, LocationID moves[NUM_MAP_LOCATIONS],
+                       PlayerID player, int road, int rail, int sea);
+
+// hunterViewToState() fills in a GameState (see GameState.h) with the
+//   current state of the game as the hunters know it, for simulating
+//   moves without a new view
+
+void hunterViewToState(HunterView currentView, GameState *state);
+
+// whereMightDraculaBe() fills in belief (see DracBelief.h) with how likely
+//   Dracula is to be at each place now, worked out from every play so far
+
+void whereMightDraculaBe(HunterView currentView, DracBelief *belief);
+
 
 #endif
@@ -0,0 +1,73 @@
+// LocSet.c ... neighbour masks and move sets built on LocSet
+
+#include <assert.h>
+#include "LocSet.h"
+#include "Map.h"
+
+// the neighbour masks, one per place and kind of transport, made by
+//  genMap along with the map itself
+#define MAPDATA_MASKS
+#include "MapData.h"
+
+LocSet neighbourSet(LocationID from, TransportID type)
+{
+    assert(validPlace(from));
+    assert(type >= MIN_TRANSPORT && type <= MAX_TRANSPORT);
+    return mapNeighbours[type][from];
+}
+
+LocSet expandSet(LocSet frontier, TransportID type)
+{
+    LocSet result = emptySet();
+    LocationID p;
+
+    assert(type >= MIN_TRANSPORT && type <= MAX_TRANSPORT);
+    while ((p = popFromSet(&frontier)) != NOWHERE) {
+        result = setUnion(result, mapNeighbours[type][p]);
+    }
+    return result;
+}
+
+LocSet movesFromSet(LocationID from, PlayerID player, Round round,
+                    int road, int rail, int sea)
+{
+    LocSet moves = singletonSet(from);
+    LocSet line, frontier;
+    int stationsAllowed, depth;
+
+    assert(validPlace(from));
+    assert(player >= PLAYER_LORD_GODALMING && player < NUM_PLAYERS);
+    assert(round >= 0);
+
+    if (road) {
+        LocSet byRoad = mapNeighbours[ROAD][from];
+        // Dracula can't move to the hospital
+        if (player == PLAYER_DRACULA) removeFromSet(&byRoad, ST_JOSEPH_AND_ST_MARYS);
+        moves = setUnion(moves, byRoad);
+    }
+    if (sea) moves = setUnion(moves, mapNeighbours[BOAT][from]);
+
+    // Dracula never takes the train
+    if (rail && player != PLAYER_DRACULA) {
+        // each pass moves the whole frontier one more stop down every line
+        stationsAllowed = (player + round) % 4;
+        line = frontier = singletonSet(from);
+        for (depth = 0; depth < stationsAllowed && !setIsEmpty(frontier); depth++) {
+            frontier = setMinus(expandSet(frontier, RAIL), line);
+            line = setUnion(line, frontier);
+        }
+        moves = setUnion(moves, line);
+    }
+    return moves;
+}
+
+int setToArray(LocSet s, LocationID connections[NUM_MAP_LOCATIONS])
+{
+    int n = 0;
+    LocationID p;
+
+    while ((p = popFromSet(&s)) != NOWHERE) {
+        connections[n++] = p;
+    }
+    return n;
+}
@@ -0,0 +1,111 @@
+// LocSet.h ... sets of places as 128-bit bitsets
+//
+// There are only 71 places, so a set of them fits in two 64-bit words.
+// Union, intersection and membership are a couple of word operations,
+// and a whole search frontier can be expanded at once by OR-ing together
+// the neighbour masks of the places in it.
+
+#ifndef LOCSET_H
+#define LOCSET_H
+
+#include "Globals.h"
+#include "Places.h"
+
+#define LOCSET_WORDS     2
+
+typedef struct locSet {
+    unsigned long long w[LOCSET_WORDS];    // bit (p % 64) of w[p / 64] is place p
+} LocSet;
+
+static inline LocSet emptySet(void)
+{
+    LocSet s = {{0, 0}};
+    return s;
+}
+
+static inline LocSet singletonSet(LocationID p)
+{
+    LocSet s = {{0, 0}};
+    s.w[p >> 6] = 1ULL << (p & 63);
+    return s;
+}
+
+static inline int inSet(LocSet s, LocationID p)
+{
+    return (s.w[p >> 6] >> (p & 63)) & 1;
+}
+
+static inline void addToSet(LocSet *s, LocationID p)
+{
+    s->w[p >> 6] |= 1ULL << (p & 63);
+}
+
+static inline void removeFromSet(LocSet *s, LocationID p)
+{
+    s->w[p >> 6] &= ~(1ULL << (p & 63));
+}
+
+static inline LocSet setUnion(LocSet a, LocSet b)
+{
+    LocSet s = {{a.w[0] | b.w[0], a.w[1] | b.w[1]}};
+    return s;
+}
+
+static inline LocSet setIntersect(LocSet a, LocSet b)
+{
+    LocSet s = {{a.w[0] & b.w[0], a.w[1] & b.w[1]}};
+    return s;
+}
+
+// everything in a that is not in b
+static inline LocSet setMinus(LocSet a, LocSet b)
+{
+    LocSet s = {{a.w[0] & ~b.w[0], a.w[1] & ~b.w[1]}};
+    return s;
+}
+
+static inline int setIsEmpty(LocSet s)
+{
+    return (s.w[0] | s.w[1]) == 0;
+}
+
+static inline int setSize(LocSet s)
+{
+    return __builtin_popcountll(s.w[0]) + __builtin_popcountll(s.w[1]);
+}
+
+// remove the lowest numbered place from the set and return it,
+//  or NOWHERE if the set is empty
+// usage: for (left = s; (p = popFromSet(&left)) != NOWHERE; ) ...
+static inline LocationID popFromSet(LocSet *s)
+{
+    LocationID p;
+    if (s->w[0] != 0) {
+        p = __builtin_ctzll(s->w[0]);
+    } else if (s->w[1] != 0) {
+        p = 64 + __builtin_ctzll(s->w[1]);
+    } else {
+        return NOWHERE;
+    }
+    s->w[p >> 6] &= s->w[p >> 6] - 1;
+    return p;
+}
+
+// places directly connected to "from" by the given kind of transport
+//  (ROAD, RAIL or BOAT), taken from the full map
+LocSet neighbourSet(LocationID from, TransportID type);
+
+// every place directly connected by the given kind of transport
+//  to some place in the frontier
+LocSet expandSet(LocSet frontier, TransportID type);
+
+// every place the player can be at after one move from "from", including
+//  staying put, with the same rules as connectedLocations() in GameView
+LocSet movesFromSet(LocationID from, PlayerID player, Round round,
+                    int road, int rail, int sea);
+
+// store the places in the set in connections, lowest first,
+//  and return how many there are
+int setToArray(LocSet s, LocationID connections[NUM_MAP_LOCATIONS]);
+
+#endif
@@ -14,17 +14,58 @@ typedef struct edge{
 // graph representation is hidden
 typedef struct MapRep *Map;
 
+// one connection in the packed (CSR) form of a map
+typedef struct mapEdge {
+    unsigned char v;       // location at the other end
+    unsigned char type;    // ROAD, RAIL, BOAT, RAIL_1 ...
+} MapEdge;
+
+// what the map says about one place (see MapData.h)
+typedef struct mapPlace {
+    unsigned char type;    // LAND or SEA
+    unsigned char roads;   // how many places it has a road to
+    unsigned char rails;   //  ... a rail line to
+    unsigned char boats;   //  ... a boat to
+} MapPlace;
+
+// walks the connections of one location, in the same order as the map's lists
+// usage: for (startEdges(g, from, &it); nextEdge(&it, &to, &type); ) ...
+typedef struct edgeIter {
+    const MapEdge *next;   // next connection to hand out
+    const MapEdge *end;    // one past the last connection
+} EdgeIter;
+
 // operations on graphs
+// the maps are tables made by genMap (see MapData.h), so making one is
+// free and every map of a kind is the same one; they must never be changed
 Map  newMap();
 void disposeMap(Map g);
 void showMap(Map g);
 int  numV(Map g);
 int  numE(Map g, TransportID t);
+void startEdges(Map g, LocationID from, EdgeIter *it);
+int  nextEdge(EdgeIter *it, LocationID *to, TransportID *type);
+
+// how many places p is connected to directly by ROAD, RAIL or BOAT
+int  numConnections(LocationID p, TransportID type);
 
 Map newRailMap();
 Map newBasicMap();
 Map newGraph();
 Map newRailGraph();
+
+// kinds of map kept by the shared map registry
+#define BASIC_MAP       0    // road and boat connections (newBasicMap)
+#define ONE_RAIL_MAP    1    // road, boat and one rail stop (newMap)
+#define RAIL_MAP        2    // road, boat and up to 3 rail stops (newRailMap)
+#define FULL_GRAPH      3    // road, rail and boat connections (newGraph)
+#define RAIL_GRAPH      4    // rail connections only (newRailGraph)
+#define NUM_MAP_KINDS   5
+
+// return the shared map of the given kind
+// (the same map as newMap() and so on return)
+Map sharedMap(int kind);
+
 //LocationID *NearbyCities(Map map, LocationID from, LocationID *nearby, int *size, int type);
 
 #endif
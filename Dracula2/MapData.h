@@ -0,0 +1,1303 @@
+// MapData.h ... the map of Europe as tables
+//
+// Made by genMap from ../LABS/lab_w7/links.txt (make mapdata),
+// so don't change it by hand.
+//
+// The tables are split in two, as a static table nobody uses won't
+// compile: Map.c defines MAPDATA_TABLES before including this, for the
+// maps' connections and what is known about each place, and LocSet.c
+// defines MAPDATA_MASKS, for the neighbour masks.
+
+#ifndef MAPDATA_H
+#define MAPDATA_H
+
+#include "Places.h"
+#include "Map.h"
+#include "LocSet.h"
+
+#ifdef MAPDATA_TABLES
+
+// how many links were added to each kind of map (its E in showMap())
+#define BASIC_MAP_LINKS          155
+#define ONE_RAIL_MAP_LINKS       198
+#define RAIL_MAP_LINKS           198
+#define FULL_GRAPH_LINKS         198
+#define RAIL_GRAPH_LINKS         43
+
+// the connections of every kind of map, packed one place after
+//  another and one kind after another (BASIC_MAP first); a place's
+//  connections start at mapOffsets[kind][place] and end where the
+//  next place's start
+static const MapEdge mapEdges[] = {
+    // BASIC_MAP
+    // ADRIATIC_SEA
+    {VENICE, BOAT}, {IONIAN_SEA, BOAT}, {BARI, BOAT},
+    // ALICANTE
+    {MEDITERRANEAN_SEA, BOAT}, {SARAGOSSA, ROAD}, {MADRID, ROAD}, {GRANADA, ROAD},
+    // AMSTERDAM
+    {NORTH_SEA, BOAT}, {COLOGNE, ROAD}, {BRUSSELS, ROAD},
+    // ATHENS
+    {IONIAN_SEA, BOAT}, {VALONA, ROAD},
+    // ATLANTIC_OCEAN
+    {NORTH_SEA, BOAT}, {MEDITERRANEAN_SEA, BOAT}, {LISBON, BOAT}, {IRISH_SEA, BOAT},
+    {GALWAY, BOAT}, {ENGLISH_CHANNEL, BOAT}, {CADIZ, BOAT}, {BAY_OF_BISCAY, BOAT},
+    // BARCELONA
+    {MEDITERRANEAN_SEA, BOAT}, {TOULOUSE, ROAD}, {SARAGOSSA, ROAD},
+    // BARI
+    {ADRIATIC_SEA, BOAT}, {ROME, ROAD}, {NAPLES, ROAD},
+    // BAY_OF_BISCAY
+    {SANTANDER, BOAT}, {NANTES, BOAT}, {BORDEAUX, BOAT}, {ATLANTIC_OCEAN, BOAT},
+    // BELGRADE
+    {SZEGED, ROAD}, {ST_JOSEPH_AND_ST_MARYS, ROAD}, {SOFIA, ROAD}, {SARAJEVO, ROAD},
+    {KLAUSENBURG, ROAD}, {BUCHAREST, ROAD},
+    // BERLIN
+    {PRAGUE, ROAD}, {LEIPZIG, ROAD}, {HAMBURG, ROAD},
+    // BLACK_SEA
+    {VARNA, BOAT}, {IONIAN_SEA, BOAT}, {CONSTANTA, BOAT},
+    // BORDEAUX
+    {BAY_OF_BISCAY, BOAT}, {TOULOUSE, ROAD}, {SARAGOSSA, ROAD}, {NANTES, ROAD},
+    {CLERMONT_FERRAND, ROAD},
+    // BRUSSELS
+    {STRASBOURG, ROAD}, {PARIS, ROAD}, {LE_HAVRE, ROAD}, {COLOGNE, ROAD},
+    {AMSTERDAM, ROAD},
+    // BUCHAREST
+    {SOFIA, ROAD}, {KLAUSENBURG, ROAD}, {GALATZ, ROAD}, {CONSTANTA, ROAD},
+    {BELGRADE, ROAD},
+    // BUDAPEST
+    {ZAGREB, ROAD}, {VIENNA, ROAD}, {SZEGED, ROAD}, {KLAUSENBURG, ROAD},
+    // CADIZ
+    {ATLANTIC_OCEAN, BOAT}, {MADRID, ROAD}, {LISBON, ROAD}, {GRANADA, ROAD},
+    // CAGLIARI
+    {TYRRHENIAN_SEA, BOAT}, {MEDITERRANEAN_SEA, BOAT},
+    // CASTLE_DRACULA
+    {KLAUSENBURG, ROAD}, {GALATZ, ROAD},
+    // CLERMONT_FERRAND
+    {TOULOUSE, ROAD}, {PARIS, ROAD}, {NANTES, ROAD}, {MARSEILLES, ROAD},
+    {GENEVA, ROAD}, {BORDEAUX, ROAD},
+    // COLOGNE
+    {STRASBOURG, ROAD}, {LEIPZIG, ROAD}, {HAMBURG, ROAD}, {FRANKFURT, ROAD},
+    {BRUSSELS, ROAD}, {AMSTERDAM, ROAD},
+    // CONSTANTA
+    {BLACK_SEA, BOAT}, {VARNA, ROAD}, {GALATZ, ROAD}, {BUCHAREST, ROAD},
+    // DUBLIN
+    {IRISH_SEA, BOAT}, {GALWAY, ROAD},
+    // EDINBURGH
+    {NORTH_SEA, BOAT}, {MANCHESTER, ROAD},
+    // ENGLISH_CHANNEL
+    {PLYMOUTH, BOAT}, {NORTH_SEA, BOAT}, {LONDON, BOAT}, {LE_HAVRE, BOAT},
+    {ATLANTIC_OCEAN, BOAT},
+    // FLORENCE
+    {VENICE, ROAD}, {ROME, ROAD}, {GENOA, ROAD},
+    // FRANKFURT
+    {STRASBOURG, ROAD}, {NUREMBURG, ROAD}, {LEIPZIG, ROAD}, {COLOGNE, ROAD},
+    // GALATZ
+    {KLAUSENBURG, ROAD}, {CONSTANTA, ROAD}, {CASTLE_DRACULA, ROAD}, {BUCHAREST, ROAD},
+    // GALWAY
+    {ATLANTIC_OCEAN, BOAT}, {DUBLIN, ROAD},
+    // GENEVA
+    {ZURICH, ROAD}, {STRASBOURG, ROAD}, {PARIS, ROAD}, {MARSEILLES, ROAD},
+    {CLERMONT_FERRAND, ROAD},
+    // GENOA
+    {TYRRHENIAN_SEA, BOAT}, {VENICE, ROAD}, {MILAN, ROAD}, {MARSEILLES, ROAD},
+    {FLORENCE, ROAD},
+    // GRANADA
+    {MADRID, ROAD}, {CADIZ, ROAD}, {ALICANTE, ROAD},
+    // HAMBURG
+    {NORTH_SEA, BOAT}, {LEIPZIG, ROAD}, {COLOGNE, ROAD}, {BERLIN, ROAD},
+    // IONIAN_SEA
+    {VALONA, BOAT}, {TYRRHENIAN_SEA, BOAT}, {SALONICA, BOAT}, {BLACK_SEA, BOAT},
+    {ATHENS, BOAT}, {ADRIATIC_SEA, BOAT},
+    // IRISH_SEA
+    {SWANSEA, BOAT}, {LIVERPOOL, BOAT}, {DUBLIN, BOAT}, {ATLANTIC_OCEAN, BOAT},
+    // KLAUSENBURG
+    {SZEGED, ROAD}, {GALATZ, ROAD}, {CASTLE_DRACULA, ROAD}, {BUDAPEST, ROAD},
+    {BUCHAREST, ROAD}, {BELGRADE, ROAD},
+    // LE_HAVRE
+    {ENGLISH_CHANNEL, BOAT}, {PARIS, ROAD}, {NANTES, ROAD}, {BRUSSELS, ROAD},
+    // LEIPZIG
+    {NUREMBURG, ROAD}, {HAMBURG, ROAD}, {FRANKFURT, ROAD}, {COLOGNE, ROAD},
+    {BERLIN, ROAD},
+    // LISBON
+    {ATLANTIC_OCEAN, BOAT}, {SANTANDER, ROAD}, {MADRID, ROAD}, {CADIZ, ROAD},
+    // LIVERPOOL
+    {IRISH_SEA, BOAT}, {SWANSEA, ROAD}, {MANCHESTER, ROAD},
+    // LONDON
+    {ENGLISH_CHANNEL, BOAT}, {SWANSEA, ROAD}, {PLYMOUTH, ROAD}, {MANCHESTER, ROAD},
+    // MADRID
+    {SARAGOSSA, ROAD}, {SANTANDER, ROAD}, {LISBON, ROAD}, {GRANADA, ROAD},
+    {CADIZ, ROAD}, {ALICANTE, ROAD},
+    // MANCHESTER
+    {LONDON, ROAD}, {LIVERPOOL, ROAD}, {EDINBURGH, ROAD},
+    // MARSEILLES
+    {MEDITERRANEAN_SEA, BOAT}, {ZURICH, ROAD}, {TOULOUSE, ROAD}, {MILAN, ROAD},
+    {GENOA, ROAD}, {GENEVA, ROAD}, {CLERMONT_FERRAND, ROAD},
+    // MEDITERRANEAN_SEA
+    {TYRRHENIAN_SEA, BOAT}, {MARSEILLES, BOAT}, {CAGLIARI, BOAT}, {BARCELONA, BOAT},
+    {ATLANTIC_OCEAN, BOAT}, {ALICANTE, BOAT},
+    // MILAN
+    {ZURICH, ROAD}, {VENICE, ROAD}, {MUNICH, ROAD}, {MARSEILLES, ROAD},
+    {GENOA, ROAD},
+    // MUNICH
+    {ZURICH, ROAD}, {ZAGREB, ROAD}, {VIENNA, ROAD}, {VENICE, ROAD},
+    {STRASBOURG, ROAD}, {NUREMBURG, ROAD}, {MILAN, ROAD},
+    // NANTES
+    {BAY_OF_BISCAY, BOAT}, {PARIS, ROAD}, {LE_HAVRE, ROAD}, {CLERMONT_FERRAND, ROAD},
+    {BORDEAUX, ROAD},
+    // NAPLES
+    {TYRRHENIAN_SEA, BOAT}, {ROME, ROAD}, {BARI, ROAD},
+    // NORTH_SEA
+    {HAMBURG, BOAT}, {ENGLISH_CHANNEL, BOAT}, {EDINBURGH, BOAT}, {ATLANTIC_OCEAN, BOAT},
+    {AMSTERDAM, BOAT},
+    // NUREMBURG
+    {STRASBOURG, ROAD}, {PRAGUE, ROAD}, {MUNICH, ROAD}, {LEIPZIG, ROAD},
+    {FRANKFURT, ROAD},
+    // PARIS
+    {STRASBOURG, ROAD}, {NANTES, ROAD}, {LE_HAVRE, ROAD}, {GENEVA, ROAD},
+    {CLERMONT_FERRAND, ROAD}, {BRUSSELS, ROAD},
+    // PLYMOUTH
+    {ENGLISH_CHANNEL, BOAT}, {LONDON, ROAD},
+    // PRAGUE
+    {VIENNA, ROAD}, {NUREMBURG, ROAD}, {BERLIN, ROAD},
+    // ROME
+    {TYRRHENIAN_SEA, BOAT}, {NAPLES, ROAD}, {FLORENCE, ROAD}, {BARI, ROAD},
+    // SALONICA
+    {IONIAN_SEA, BOAT}, {VALONA, ROAD}, {SOFIA, ROAD},
+    // SANTANDER
+    {BAY_OF_BISCAY, BOAT}, {SARAGOSSA, ROAD}, {MADRID, ROAD}, {LISBON, ROAD},
+    // SARAGOSSA
+    {TOULOUSE, ROAD}, {SANTANDER, ROAD}, {MADRID, ROAD}, {BORDEAUX, ROAD},
+    {BARCELONA, ROAD}, {ALICANTE, ROAD},
+    // SARAJEVO
+    {ZAGREB, ROAD}, {VALONA, ROAD}, {ST_JOSEPH_AND_ST_MARYS, ROAD}, {SOFIA, ROAD},
+    {BELGRADE, ROAD},
+    // SOFIA
+    {VARNA, ROAD}, {VALONA, ROAD}, {SARAJEVO, ROAD}, {SALONICA, ROAD},
+    {BUCHAREST, ROAD}, {BELGRADE, ROAD},
+    // ST_JOSEPH_AND_ST_MARYS
+    {ZAGREB, ROAD}, {SZEGED, ROAD}, {SARAJEVO, ROAD}, {BELGRADE, ROAD},
+    // STRASBOURG
+    {ZURICH, ROAD}, {PARIS, ROAD}, {NUREMBURG, ROAD}, {MUNICH, ROAD},
+    {GENEVA, ROAD}, {FRANKFURT, ROAD}, {COLOGNE, ROAD}, {BRUSSELS, ROAD},
+    // SWANSEA
+    {IRISH_SEA, BOAT}, {LONDON, ROAD}, {LIVERPOOL, ROAD},
+    // SZEGED
+    {ZAGREB, ROAD}, {ST_JOSEPH_AND_ST_MARYS, ROAD}, {KLAUSENBURG, ROAD}, {BUDAPEST, ROAD},
+    {BELGRADE, ROAD},
+    // TOULOUSE
+    {SARAGOSSA, ROAD}, {MARSEILLES, ROAD}, {CLERMONT_FERRAND, ROAD}, {BORDEAUX, ROAD},
+    {BARCELONA, ROAD},
+    // TYRRHENIAN_SEA
+    {ROME, BOAT}, {NAPLES, BOAT}, {MEDITERRANEAN_SEA, BOAT}, {IONIAN_SEA, BOAT},
+    {GENOA, BOAT}, {CAGLIARI, BOAT},
+    // VALONA
+    {IONIAN_SEA, BOAT}, {SOFIA, ROAD}, {SARAJEVO, ROAD}, {SALONICA, ROAD},
+    {ATHENS, ROAD},
+    // VARNA
+    {BLACK_SEA, BOAT}, {SOFIA, ROAD}, {CONSTANTA, ROAD},
+    // VENICE
+    {ADRIATIC_SEA, BOAT}, {MUNICH, ROAD}, {MILAN, ROAD}, {GENOA, ROAD},
+    {FLORENCE, ROAD},
+    // VIENNA
+    {ZAGREB, ROAD}, {PRAGUE, ROAD}, {MUNICH, ROAD}, {BUDAPEST, ROAD},
+    // ZAGREB
+    {VIENNA, ROAD}, {SZEGED, ROAD}, {ST_JOSEPH_AND_ST_MARYS, ROAD}, {SARAJEVO, ROAD},
+    {MUNICH, ROAD}, {BUDAPEST, ROAD},
+    // ZURICH
+    {STRASBOURG, ROAD}, {MUNICH, ROAD}, {MILAN, ROAD}, {MARSEILLES, ROAD},
+    {GENEVA, ROAD},
+    // ONE_RAIL_MAP
+    // ADRIATIC_SEA
+    {VENICE, BOAT}, {IONIAN_SEA, BOAT}, {BARI, BOAT},
+    // ALICANTE
+    {MEDITERRANEAN_SEA, BOAT}, {SARAGOSSA, ROAD}, {MADRID, ROAD}, {GRANADA, ROAD},
+    {MADRID, RAIL_1}, {BARCELONA, RAIL_1},
+    // AMSTERDAM
+    {NORTH_SEA, BOAT}, {COLOGNE, ROAD}, {BRUSSELS, ROAD},
+    // ATHENS
+    {IONIAN_SEA, BOAT}, {VALONA, ROAD},
+    // ATLANTIC_OCEAN
+    {NORTH_SEA, BOAT}, {MEDITERRANEAN_SEA, BOAT}, {LISBON, BOAT}, {IRISH_SEA, BOAT},
+    {GALWAY, BOAT}, {ENGLISH_CHANNEL, BOAT}, {CADIZ, BOAT}, {BAY_OF_BISCAY, BOAT},
+    // BARCELONA
+    {MEDITERRANEAN_SEA, BOAT}, {TOULOUSE, ROAD}, {SARAGOSSA, ROAD}, {SARAGOSSA, RAIL_1},
+    {ALICANTE, RAIL_1},
+    // BARI
+    {ADRIATIC_SEA, BOAT}, {ROME, ROAD}, {NAPLES, ROAD}, {NAPLES, RAIL_1},
+    // BAY_OF_BISCAY
+    {SANTANDER, BOAT}, {NANTES, BOAT}, {BORDEAUX, BOAT}, {ATLANTIC_OCEAN, BOAT},
+    // BELGRADE
+    {SZEGED, ROAD}, {ST_JOSEPH_AND_ST_MARYS, ROAD}, {SOFIA, ROAD}, {SARAJEVO, ROAD},
+    {KLAUSENBURG, ROAD}, {BUCHAREST, ROAD}, {SZEGED, RAIL_1}, {SOFIA, RAIL_1},
+    // BERLIN
+    {PRAGUE, ROAD}, {LEIPZIG, ROAD}, {HAMBURG, ROAD}, {PRAGUE, RAIL_1},
+    {LEIPZIG, RAIL_1}, {HAMBURG, RAIL_1},
+    // BLACK_SEA
+    {VARNA, BOAT}, {IONIAN_SEA, BOAT}, {CONSTANTA, BOAT},
+    // BORDEAUX
+    {BAY_OF_BISCAY, BOAT}, {TOULOUSE, ROAD}, {SARAGOSSA, ROAD}, {NANTES, ROAD},
+    {CLERMONT_FERRAND, ROAD}, {SARAGOSSA, RAIL_1}, {PARIS, RAIL_1},
+    // BRUSSELS
+    {STRASBOURG, ROAD}, {PARIS, ROAD}, {LE_HAVRE, ROAD}, {COLOGNE, ROAD},
+    {AMSTERDAM, ROAD}, {PARIS, RAIL_1}, {COLOGNE, RAIL_1},
+    // BUCHAREST
+    {SOFIA, ROAD}, {KLAUSENBURG, ROAD}, {GALATZ, ROAD}, {CONSTANTA, ROAD},
+    {BELGRADE, ROAD}, {SZEGED, RAIL_1}, {GALATZ, RAIL_1}, {CONSTANTA, RAIL_1},
+    // BUDAPEST
+    {ZAGREB, ROAD}, {VIENNA, ROAD}, {SZEGED, ROAD}, {KLAUSENBURG, ROAD},
+    {VIENNA, RAIL_1}, {SZEGED, RAIL_1},
+    // CADIZ
+    {ATLANTIC_OCEAN, BOAT}, {MADRID, ROAD}, {LISBON, ROAD}, {GRANADA, ROAD},
+    // CAGLIARI
+    {TYRRHENIAN_SEA, BOAT}, {MEDITERRANEAN_SEA, BOAT},
+    // CASTLE_DRACULA
+    {KLAUSENBURG, ROAD}, {GALATZ, ROAD},
+    // CLERMONT_FERRAND
+    {TOULOUSE, ROAD}, {PARIS, ROAD}, {NANTES, ROAD}, {MARSEILLES, ROAD},
+    {GENEVA, ROAD}, {BORDEAUX, ROAD},
+    // COLOGNE
+    {STRASBOURG, ROAD}, {LEIPZIG, ROAD}, {HAMBURG, ROAD}, {FRANKFURT, ROAD},
+    {BRUSSELS, ROAD}, {AMSTERDAM, ROAD}, {FRANKFURT, RAIL_1}, {BRUSSELS, RAIL_1},
+    // CONSTANTA
+    {BLACK_SEA, BOAT}, {VARNA, ROAD}, {GALATZ, ROAD}, {BUCHAREST, ROAD},
+    {BUCHAREST, RAIL_1},
+    // DUBLIN
+    {IRISH_SEA, BOAT}, {GALWAY, ROAD},
+    // EDINBURGH
+    {NORTH_SEA, BOAT}, {MANCHESTER, ROAD}, {MANCHESTER, RAIL_1},
+    // ENGLISH_CHANNEL
+    {PLYMOUTH, BOAT}, {NORTH_SEA, BOAT}, {LONDON, BOAT}, {LE_HAVRE, BOAT},
+    {ATLANTIC_OCEAN, BOAT},
+    // FLORENCE
+    {VENICE, ROAD}, {ROME, ROAD}, {GENOA, ROAD}, {ROME, RAIL_1},
+    {MILAN, RAIL_1},
+    // FRANKFURT
+    {STRASBOURG, ROAD}, {NUREMBURG, ROAD}, {LEIPZIG, ROAD}, {COLOGNE, ROAD},
+    {STRASBOURG, RAIL_1}, {LEIPZIG, RAIL_1}, {COLOGNE, RAIL_1},
+    // GALATZ
+    {KLAUSENBURG, ROAD}, {CONSTANTA, ROAD}, {CASTLE_DRACULA, ROAD}, {BUCHAREST, ROAD},
+    {BUCHAREST, RAIL_1},
+    // GALWAY
+    {ATLANTIC_OCEAN, BOAT}, {DUBLIN, ROAD},
+    // GENEVA
+    {ZURICH, ROAD}, {STRASBOURG, ROAD}, {PARIS, ROAD}, {MARSEILLES, ROAD},
+    {CLERMONT_FERRAND, ROAD}, {MILAN, RAIL_1},
+    // GENOA
+    {TYRRHENIAN_SEA, BOAT}, {VENICE, ROAD}, {MILAN, ROAD}, {MARSEILLES, ROAD},
+    {FLORENCE, ROAD}, {MILAN, RAIL_1},
+    // GRANADA
+    {MADRID, ROAD}, {CADIZ, ROAD}, {ALICANTE, ROAD},
+    // HAMBURG
+    {NORTH_SEA, BOAT}, {LEIPZIG, ROAD}, {COLOGNE, ROAD}, {BERLIN, ROAD},
+    {BERLIN, RAIL_1},
+    // IONIAN_SEA
+    {VALONA, BOAT}, {TYRRHENIAN_SEA, BOAT}, {SALONICA, BOAT}, {BLACK_SEA, BOAT},
+    {ATHENS, BOAT}, {ADRIATIC_SEA, BOAT},
+    // IRISH_SEA
+    {SWANSEA, BOAT}, {LIVERPOOL, BOAT}, {DUBLIN, BOAT}, {ATLANTIC_OCEAN, BOAT},
+    // KLAUSENBURG
+    {SZEGED, ROAD}, {GALATZ, ROAD}, {CASTLE_DRACULA, ROAD}, {BUDAPEST, ROAD},
+    {BUCHAREST, ROAD}, {BELGRADE, ROAD},
+    // LE_HAVRE
+    {ENGLISH_CHANNEL, BOAT}, {PARIS, ROAD}, {NANTES, ROAD}, {BRUSSELS, ROAD},
+    {PARIS, RAIL_1},
+    // LEIPZIG
+    {NUREMBURG, ROAD}, {HAMBURG, ROAD}, {FRANKFURT, ROAD}, {COLOGNE, ROAD},
+    {BERLIN, ROAD}, {NUREMBURG, RAIL_1}, {FRANKFURT, RAIL_1}, {BERLIN, RAIL_1},
+    // LISBON
+    {ATLANTIC_OCEAN, BOAT}, {SANTANDER, ROAD}, {MADRID, ROAD}, {CADIZ, ROAD},
+    {MADRID, RAIL_1},
+    // LIVERPOOL
+    {IRISH_SEA, BOAT}, {SWANSEA, ROAD}, {MANCHESTER, ROAD}, {MANCHESTER, RAIL_1},
+    // LONDON
+    {ENGLISH_CHANNEL, BOAT}, {SWANSEA, ROAD}, {PLYMOUTH, ROAD}, {MANCHESTER, ROAD},
+    {SWANSEA, RAIL_1}, {MANCHESTER, RAIL_1},
+    // MADRID
+    {SARAGOSSA, ROAD}, {SANTANDER, ROAD}, {LISBON, ROAD}, {GRANADA, ROAD},
+    {CADIZ, ROAD}, {ALICANTE, ROAD}, {SARAGOSSA, RAIL_1}, {SANTANDER, RAIL_1},
+    {LISBON, RAIL_1}, {ALICANTE, RAIL_1},
+    // MANCHESTER
+    {LONDON, ROAD}, {LIVERPOOL, ROAD}, {EDINBURGH, ROAD}, {LONDON, RAIL_1},
+    {LIVERPOOL, RAIL_1}, {EDINBURGH, RAIL_1},
+    // MARSEILLES
+    {MEDITERRANEAN_SEA, BOAT}, {ZURICH, ROAD}, {TOULOUSE, ROAD}, {MILAN, ROAD},
+    {GENOA, ROAD}, {GENEVA, ROAD}, {CLERMONT_FERRAND, ROAD}, {PARIS, RAIL_1},
+    // MEDITERRANEAN_SEA
+    {TYRRHENIAN_SEA, BOAT}, {MARSEILLES, BOAT}, {CAGLIARI, BOAT}, {BARCELONA, BOAT},
+    {ATLANTIC_OCEAN, BOAT}, {ALICANTE, BOAT},
+    // MILAN
+    {ZURICH, ROAD}, {VENICE, ROAD}, {MUNICH, ROAD}, {MARSEILLES, ROAD},
+    {GENOA, ROAD}, {ZURICH, RAIL_1}, {GENOA, RAIL_1}, {GENEVA, RAIL_1},
+    {FLORENCE, RAIL_1},
+    // MUNICH
+    {ZURICH, ROAD}, {ZAGREB, ROAD}, {VIENNA, ROAD}, {VENICE, ROAD},
+    {STRASBOURG, ROAD}, {NUREMBURG, ROAD}, {MILAN, ROAD}, {NUREMBURG, RAIL_1},
+    // NANTES
+    {BAY_OF_BISCAY, BOAT}, {PARIS, ROAD}, {LE_HAVRE, ROAD}, {CLERMONT_FERRAND, ROAD},
+    {BORDEAUX, ROAD},
+    // NAPLES
+    {TYRRHENIAN_SEA, BOAT}, {ROME, ROAD}, {BARI, ROAD}, {ROME, RAIL_1},
+    {BARI, RAIL_1},
+    // NORTH_SEA
+    {HAMBURG, BOAT}, {ENGLISH_CHANNEL, BOAT}, {EDINBURGH, BOAT}, {ATLANTIC_OCEAN, BOAT},
+    {AMSTERDAM, BOAT},
+    // NUREMBURG
+    {STRASBOURG, ROAD}, {PRAGUE, ROAD}, {MUNICH, ROAD}, {LEIPZIG, ROAD},
+    {FRANKFURT, ROAD}, {MUNICH, RAIL_1}, {LEIPZIG, RAIL_1},
+    // PARIS
+    {STRASBOURG, ROAD}, {NANTES, ROAD}, {LE_HAVRE, ROAD}, {GENEVA, ROAD},
+    {CLERMONT_FERRAND, ROAD}, {BRUSSELS, ROAD}, {MARSEILLES, RAIL_1}, {LE_HAVRE, RAIL_1},
+    {BRUSSELS, RAIL_1}, {BORDEAUX, RAIL_1},
+    // PLYMOUTH
+    {ENGLISH_CHANNEL, BOAT}, {LONDON, ROAD},
+    // PRAGUE
+    {VIENNA, ROAD}, {NUREMBURG, ROAD}, {BERLIN, ROAD}, {VIENNA, RAIL_1},
+    {BERLIN, RAIL_1},
+    // ROME
+    {TYRRHENIAN_SEA, BOAT}, {NAPLES, ROAD}, {FLORENCE, ROAD}, {BARI, ROAD},
+    {NAPLES, RAIL_1}, {FLORENCE, RAIL_1},
+    // SALONICA
+    {IONIAN_SEA, BOAT}, {VALONA, ROAD}, {SOFIA, ROAD}, {SOFIA, RAIL_1},
+    // SANTANDER
+    {BAY_OF_BISCAY, BOAT}, {SARAGOSSA, ROAD}, {MADRID, ROAD}, {LISBON, ROAD},
+    {MADRID, RAIL_1},
+    // SARAGOSSA
+    {TOULOUSE, ROAD}, {SANTANDER, ROAD}, {MADRID, ROAD}, {BORDEAUX, ROAD},
+    {BARCELONA, ROAD}, {ALICANTE, ROAD}, {MADRID, RAIL_1}, {BORDEAUX, RAIL_1},
+    {BARCELONA, RAIL_1},
+    // SARAJEVO
+    {ZAGREB, ROAD}, {VALONA, ROAD}, {ST_JOSEPH_AND_ST_MARYS, ROAD}, {SOFIA, ROAD},
+    {BELGRADE, ROAD},
+    // SOFIA
+    {VARNA, ROAD}, {VALONA, ROAD}, {SARAJEVO, ROAD}, {SALONICA, ROAD},
+    {BUCHAREST, ROAD}, {BELGRADE, ROAD}, {VARNA, RAIL_1}, {SALONICA, RAIL_1},
+    {BELGRADE, RAIL_1},
+    // ST_JOSEPH_AND_ST_MARYS
+    {ZAGREB, ROAD}, {SZEGED, ROAD}, {SARAJEVO, ROAD}, {BELGRADE, ROAD},
+    // STRASBOURG
+    {ZURICH, ROAD}, {PARIS, ROAD}, {NUREMBURG, ROAD}, {MUNICH, ROAD},
+    {GENEVA, ROAD}, {FRANKFURT, ROAD}, {COLOGNE, ROAD}, {BRUSSELS, ROAD},
+    {ZURICH, RAIL_1}, {FRANKFURT, RAIL_1},
+    // SWANSEA
+    {IRISH_SEA, BOAT}, {LONDON, ROAD}, {LIVERPOOL, ROAD}, {LONDON, RAIL_1},
+    // SZEGED
+    {ZAGREB, ROAD}, {ST_JOSEPH_AND_ST_MARYS, ROAD}, {KLAUSENBURG, ROAD}, {BUDAPEST, ROAD},
+    {BELGRADE, ROAD}, {BUDAPEST, RAIL_1}, {BUCHAREST, RAIL_1}, {BELGRADE, RAIL_1},
+    // TOULOUSE
+    {SARAGOSSA, ROAD}, {MARSEILLES, ROAD}, {CLERMONT_FERRAND, ROAD}, {BORDEAUX, ROAD},
+    {BARCELONA, ROAD},
+    // TYRRHENIAN_SEA
+    {ROME, BOAT}, {NAPLES, BOAT}, {MEDITERRANEAN_SEA, BOAT}, {IONIAN_SEA, BOAT},
+    {GENOA, BOAT}, {CAGLIARI, BOAT},
+    // VALONA
+    {IONIAN_SEA, BOAT}, {SOFIA, ROAD}, {SARAJEVO, ROAD}, {SALONICA, ROAD},
+    {ATHENS, ROAD},
+    // VARNA
+    {BLACK_SEA, BOAT}, {SOFIA, ROAD}, {CONSTANTA, ROAD}, {SOFIA, RAIL_1},
+    // VENICE
+    {ADRIATIC_SEA, BOAT}, {MUNICH, ROAD}, {MILAN, ROAD}, {GENOA, ROAD},
+    {FLORENCE, ROAD}, {VIENNA, RAIL_1},
+    // VIENNA
+    {ZAGREB, ROAD}, {PRAGUE, ROAD}, {MUNICH, ROAD}, {BUDAPEST, ROAD},
+    {VENICE, RAIL_1}, {PRAGUE, RAIL_1}, {BUDAPEST, RAIL_1},
+    // ZAGREB
+    {VIENNA, ROAD}, {SZEGED, ROAD}, {ST_JOSEPH_AND_ST_MARYS, ROAD}, {SARAJEVO, ROAD},
+    {MUNICH, ROAD}, {BUDAPEST, ROAD},
+    // ZURICH
+    {STRASBOURG, ROAD}, {MUNICH, ROAD}, {MILAN, ROAD}, {MARSEILLES, ROAD},
+    {GENEVA, ROAD}, {STRASBOURG, RAIL_1}, {MILAN, RAIL_1},
+    // RAIL_MAP
+    // ADRIATIC_SEA
+    {VENICE, BOAT}, {IONIAN_SEA, BOAT}, {BARI, BOAT},
+    // ALICANTE
+    {MEDITERRANEAN_SEA, BOAT}, {SARAGOSSA, ROAD}, {MADRID, ROAD}, {GRANADA, ROAD},
+    {BORDEAUX, RAIL_3}, {SARAGOSSA, RAIL_2}, {SANTANDER, RAIL_2}, {LISBON, RAIL_2},
+    {ALICANTE, RAIL_2}, {MADRID, RAIL_1}, {BARCELONA, RAIL_1},
+    // AMSTERDAM
+    {NORTH_SEA, BOAT}, {COLOGNE, ROAD}, {BRUSSELS, ROAD},
+    // ATHENS
+    {IONIAN_SEA, BOAT}, {VALONA, ROAD},
+    // ATLANTIC_OCEAN
+    {NORTH_SEA, BOAT}, {MEDITERRANEAN_SEA, BOAT}, {LISBON, BOAT}, {IRISH_SEA, BOAT},
+    {GALWAY, BOAT}, {ENGLISH_CHANNEL, BOAT}, {CADIZ, BOAT}, {BAY_OF_BISCAY, BOAT},
+    // BARCELONA
+    {MEDITERRANEAN_SEA, BOAT}, {TOULOUSE, ROAD}, {SARAGOSSA, ROAD}, {SANTANDER, RAIL_3},
+    {LISBON, RAIL_3}, {PARIS, RAIL_3}, {MADRID, RAIL_2}, {BORDEAUX, RAIL_2},
+    {BARCELONA, RAIL_2}, {SARAGOSSA, RAIL_1}, {ALICANTE, RAIL_1},
+    // BARI
+    {ADRIATIC_SEA, BOAT}, {ROME, ROAD}, {NAPLES, ROAD}, {FLORENCE, RAIL_3},
+    {ROME, RAIL_2}, {BARI, RAIL_2}, {NAPLES, RAIL_1},
+    // BAY_OF_BISCAY
+    {SANTANDER, BOAT}, {NANTES, BOAT}, {BORDEAUX, BOAT}, {ATLANTIC_OCEAN, BOAT},
+    // BELGRADE
+    {SZEGED, ROAD}, {ST_JOSEPH_AND_ST_MARYS, ROAD}, {SOFIA, ROAD}, {SARAJEVO, ROAD},
+    {KLAUSENBURG, ROAD}, {BUCHAREST, ROAD}, {VIENNA, RAIL_3}, {GALATZ, RAIL_3},
+    {CONSTANTA, RAIL_3}, {BUDAPEST, RAIL_2}, {BUCHAREST, RAIL_2}, {BELGRADE, RAIL_2},
+    {VARNA, RAIL_2}, {SALONICA, RAIL_2}, {SZEGED, RAIL_1}, {SOFIA, RAIL_1},
+    // BERLIN
+    {PRAGUE, ROAD}, {LEIPZIG, ROAD}, {HAMBURG, ROAD}, {VENICE, RAIL_3},
+    {BUDAPEST, RAIL_3}, {MUNICH, RAIL_3}, {STRASBOURG, RAIL_3}, {COLOGNE, RAIL_3},
+    {VIENNA, RAIL_2}, {BERLIN, RAIL_2}, {NUREMBURG, RAIL_2}, {FRANKFURT, RAIL_2},
+    {PRAGUE, RAIL_1}, {LEIPZIG, RAIL_1}, {HAMBURG, RAIL_1},
+    // BLACK_SEA
+    {VARNA, BOAT}, {IONIAN_SEA, BOAT}, {CONSTANTA, BOAT},
+    // BORDEAUX
+    {BAY_OF_BISCAY, BOAT}, {TOULOUSE, ROAD}, {SARAGOSSA, ROAD}, {NANTES, ROAD},
+    {CLERMONT_FERRAND, ROAD}, {SANTANDER, RAIL_3}, {LISBON, RAIL_3}, {ALICANTE, RAIL_3},
+    {COLOGNE, RAIL_3}, {MADRID, RAIL_2}, {BORDEAUX, RAIL_2}, {BARCELONA, RAIL_2},
+    {MARSEILLES, RAIL_2}, {LE_HAVRE, RAIL_2}, {BRUSSELS, RAIL_2}, {SARAGOSSA, RAIL_1},
+    {PARIS, RAIL_1},
+    // BRUSSELS
+    {STRASBOURG, ROAD}, {PARIS, ROAD}, {LE_HAVRE, ROAD}, {COLOGNE, ROAD},
+    {AMSTERDAM, ROAD}, {SARAGOSSA, RAIL_3}, {STRASBOURG, RAIL_3}, {LEIPZIG, RAIL_3},
+    {MARSEILLES, RAIL_2}, {LE_HAVRE, RAIL_2}, {BRUSSELS, RAIL_2}, {BORDEAUX, RAIL_2},
+    {FRANKFURT, RAIL_2}, {PARIS, RAIL_1}, {COLOGNE, RAIL_1},
+    // BUCHAREST
+    {SOFIA, ROAD}, {KLAUSENBURG, ROAD}, {GALATZ, ROAD}, {CONSTANTA, ROAD},
+    {BELGRADE, ROAD}, {VIENNA, RAIL_3}, {SOFIA, RAIL_3}, {BUDAPEST, RAIL_2},
+    {BUCHAREST, RAIL_2}, {BELGRADE, RAIL_2}, {SZEGED, RAIL_1}, {GALATZ, RAIL_1},
+    {CONSTANTA, RAIL_1},
+    // BUDAPEST
+    {ZAGREB, ROAD}, {VIENNA, ROAD}, {SZEGED, ROAD}, {KLAUSENBURG, ROAD},
+    {BERLIN, RAIL_3}, {GALATZ, RAIL_3}, {CONSTANTA, RAIL_3}, {SOFIA, RAIL_3},
+    {VENICE, RAIL_2}, {PRAGUE, RAIL_2}, {BUDAPEST, RAIL_2}, {BUCHAREST, RAIL_2},
+    {BELGRADE, RAIL_2}, {VIENNA, RAIL_1}, {SZEGED, RAIL_1},
+    // CADIZ
+    {ATLANTIC_OCEAN, BOAT}, {MADRID, ROAD}, {LISBON, ROAD}, {GRANADA, ROAD},
+    // CAGLIARI
+    {TYRRHENIAN_SEA, BOAT}, {MEDITERRANEAN_SEA, BOAT},
+    // CASTLE_DRACULA
+    {KLAUSENBURG, ROAD}, {GALATZ, ROAD},
+    // CLERMONT_FERRAND
+    {TOULOUSE, ROAD}, {PARIS, ROAD}, {NANTES, ROAD}, {MARSEILLES, ROAD},
+    {GENEVA, ROAD}, {BORDEAUX, ROAD},
+    // COLOGNE
+    {STRASBOURG, ROAD}, {LEIPZIG, ROAD}, {HAMBURG, ROAD}, {FRANKFURT, ROAD},
+    {BRUSSELS, ROAD}, {AMSTERDAM, ROAD}, {ZURICH, RAIL_3}, {NUREMBURG, RAIL_3},
+    {BERLIN, RAIL_3}, {MARSEILLES, RAIL_3}, {LE_HAVRE, RAIL_3}, {BORDEAUX, RAIL_3},
+    {STRASBOURG, RAIL_2}, {LEIPZIG, RAIL_2}, {COLOGNE, RAIL_2}, {PARIS, RAIL_2},
+    {FRANKFURT, RAIL_1}, {BRUSSELS, RAIL_1},
+    // CONSTANTA
+    {BLACK_SEA, BOAT}, {VARNA, ROAD}, {GALATZ, ROAD}, {BUCHAREST, ROAD},
+    {BUDAPEST, RAIL_3}, {BELGRADE, RAIL_3}, {SZEGED, RAIL_2}, {GALATZ, RAIL_2},
+    {CONSTANTA, RAIL_2}, {BUCHAREST, RAIL_1},
+    // DUBLIN
+    {IRISH_SEA, BOAT}, {GALWAY, ROAD},
+    // EDINBURGH
+    {NORTH_SEA, BOAT}, {MANCHESTER, ROAD}, {SWANSEA, RAIL_3}, {LONDON, RAIL_2},
+    {LIVERPOOL, RAIL_2}, {EDINBURGH, RAIL_2}, {MANCHESTER, RAIL_1},
+    // ENGLISH_CHANNEL
+    {PLYMOUTH, BOAT}, {NORTH_SEA, BOAT}, {LONDON, BOAT}, {LE_HAVRE, BOAT},
+    {ATLANTIC_OCEAN, BOAT},
+    // FLORENCE
+    {VENICE, ROAD}, {ROME, ROAD}, {GENOA, ROAD}, {BARI, RAIL_3},
+    {STRASBOURG, RAIL_3}, {NAPLES, RAIL_2}, {FLORENCE, RAIL_2}, {ZURICH, RAIL_2},
+    {GENOA, RAIL_2}, {GENEVA, RAIL_2}, {ROME, RAIL_1}, {MILAN, RAIL_1},
+    // FRANKFURT
+    {STRASBOURG, ROAD}, {NUREMBURG, ROAD}, {LEIPZIG, ROAD}, {COLOGNE, ROAD},
+    {MILAN, RAIL_3}, {MUNICH, RAIL_3}, {PRAGUE, RAIL_3}, {HAMBURG, RAIL_3},
+    {PARIS, RAIL_3}, {ZURICH, RAIL_2}, {FRANKFURT, RAIL_2}, {NUREMBURG, RAIL_2},
+    {BERLIN, RAIL_2}, {BRUSSELS, RAIL_2}, {STRASBOURG, RAIL_1}, {LEIPZIG, RAIL_1},
+    {COLOGNE, RAIL_1},
+    // GALATZ
+    {KLAUSENBURG, ROAD}, {CONSTANTA, ROAD}, {CASTLE_DRACULA, ROAD}, {BUCHAREST, ROAD},
+    {BUDAPEST, RAIL_3}, {BELGRADE, RAIL_3}, {SZEGED, RAIL_2}, {GALATZ, RAIL_2},
+    {CONSTANTA, RAIL_2}, {BUCHAREST, RAIL_1},
+    // GALWAY
+    {ATLANTIC_OCEAN, BOAT}, {DUBLIN, ROAD},
+    // GENEVA
+    {ZURICH, ROAD}, {STRASBOURG, ROAD}, {PARIS, ROAD}, {MARSEILLES, ROAD},
+    {CLERMONT_FERRAND, ROAD}, {STRASBOURG, RAIL_3}, {ROME, RAIL_3}, {ZURICH, RAIL_2},
+    {GENOA, RAIL_2}, {GENEVA, RAIL_2}, {FLORENCE, RAIL_2}, {MILAN, RAIL_1},
+    // GENOA
+    {TYRRHENIAN_SEA, BOAT}, {VENICE, ROAD}, {MILAN, ROAD}, {MARSEILLES, ROAD},
+    {FLORENCE, ROAD}, {STRASBOURG, RAIL_3}, {ROME, RAIL_3}, {ZURICH, RAIL_2},
+    {GENOA, RAIL_2}, {GENEVA, RAIL_2}, {FLORENCE, RAIL_2}, {MILAN, RAIL_1},
+    // GRANADA
+    {MADRID, ROAD}, {CADIZ, ROAD}, {ALICANTE, ROAD},
+    // HAMBURG
+    {NORTH_SEA, BOAT}, {LEIPZIG, ROAD}, {COLOGNE, ROAD}, {BERLIN, ROAD},
+    {VIENNA, RAIL_3}, {NUREMBURG, RAIL_3}, {FRANKFURT, RAIL_3}, {PRAGUE, RAIL_2},
+    {LEIPZIG, RAIL_2}, {HAMBURG, RAIL_2}, {BERLIN, RAIL_1},
+    // IONIAN_SEA
+    {VALONA, BOAT}, {TYRRHENIAN_SEA, BOAT}, {SALONICA, BOAT}, {BLACK_SEA, BOAT},
+    {ATHENS, BOAT}, {ADRIATIC_SEA, BOAT},
+    // IRISH_SEA
+    {SWANSEA, BOAT}, {LIVERPOOL, BOAT}, {DUBLIN, BOAT}, {ATLANTIC_OCEAN, BOAT},
+    // KLAUSENBURG
+    {SZEGED, ROAD}, {GALATZ, ROAD}, {CASTLE_DRACULA, ROAD}, {BUDAPEST, ROAD},
+    {BUCHAREST, ROAD}, {BELGRADE, ROAD},
+    // LE_HAVRE
+    {ENGLISH_CHANNEL, BOAT}, {PARIS, ROAD}, {NANTES, ROAD}, {BRUSSELS, ROAD},
+    {COLOGNE, RAIL_3}, {SARAGOSSA, RAIL_3}, {MARSEILLES, RAIL_2}, {LE_HAVRE, RAIL_2},
+    {BRUSSELS, RAIL_2}, {BORDEAUX, RAIL_2}, {PARIS, RAIL_1},
+    // LEIPZIG
+    {NUREMBURG, ROAD}, {HAMBURG, ROAD}, {FRANKFURT, ROAD}, {COLOGNE, ROAD},
+    {BERLIN, ROAD}, {ZURICH, RAIL_3}, {BRUSSELS, RAIL_3}, {VIENNA, RAIL_3},
+    {MUNICH, RAIL_2}, {LEIPZIG, RAIL_2}, {STRASBOURG, RAIL_2}, {COLOGNE, RAIL_2},
+    {PRAGUE, RAIL_2}, {HAMBURG, RAIL_2}, {NUREMBURG, RAIL_1}, {FRANKFURT, RAIL_1},
+    {BERLIN, RAIL_1},
+    // LISBON
+    {ATLANTIC_OCEAN, BOAT}, {SANTANDER, ROAD}, {MADRID, ROAD}, {CADIZ, ROAD},
+    {BORDEAUX, RAIL_3}, {BARCELONA, RAIL_3}, {SARAGOSSA, RAIL_2}, {SANTANDER, RAIL_2},
+    {LISBON, RAIL_2}, {ALICANTE, RAIL_2}, {MADRID, RAIL_1},
+    // LIVERPOOL
+    {IRISH_SEA, BOAT}, {SWANSEA, ROAD}, {MANCHESTER, ROAD}, {SWANSEA, RAIL_3},
+    {LONDON, RAIL_2}, {LIVERPOOL, RAIL_2}, {EDINBURGH, RAIL_2}, {MANCHESTER, RAIL_1},
+    // LONDON
+    {ENGLISH_CHANNEL, BOAT}, {SWANSEA, ROAD}, {PLYMOUTH, ROAD}, {MANCHESTER, ROAD},
+    // MADRID
+    {SARAGOSSA, ROAD}, {SANTANDER, ROAD}, {LISBON, ROAD}, {GRANADA, ROAD},
+    {CADIZ, ROAD}, {ALICANTE, ROAD}, {PARIS, RAIL_3}, {MADRID, RAIL_2},
+    {BORDEAUX, RAIL_2}, {BARCELONA, RAIL_2}, {SARAGOSSA, RAIL_1}, {SANTANDER, RAIL_1},
+    {LISBON, RAIL_1}, {ALICANTE, RAIL_1},
+    // MANCHESTER
+    {LONDON, ROAD}, {LIVERPOOL, ROAD}, {EDINBURGH, ROAD},
+    // MARSEILLES
+    {MEDITERRANEAN_SEA, BOAT}, {ZURICH, ROAD}, {TOULOUSE, ROAD}, {MILAN, ROAD},
+    {GENOA, ROAD}, {GENEVA, ROAD}, {CLERMONT_FERRAND, ROAD}, {COLOGNE, RAIL_3},
+    {SARAGOSSA, RAIL_3}, {MARSEILLES, RAIL_2}, {LE_HAVRE, RAIL_2}, {BRUSSELS, RAIL_2},
+    {BORDEAUX, RAIL_2}, {PARIS, RAIL_1},
+    // MEDITERRANEAN_SEA
+    {TYRRHENIAN_SEA, BOAT}, {MARSEILLES, BOAT}, {CAGLIARI, BOAT}, {BARCELONA, BOAT},
+    {ATLANTIC_OCEAN, BOAT}, {ALICANTE, BOAT},
+    // MILAN
+    {ZURICH, ROAD}, {VENICE, ROAD}, {MUNICH, ROAD}, {MARSEILLES, ROAD},
+    {GENOA, ROAD}, {FRANKFURT, RAIL_3}, {NAPLES, RAIL_3}, {STRASBOURG, RAIL_2},
+    {MILAN, RAIL_2}, {ROME, RAIL_2}, {ZURICH, RAIL_1}, {GENOA, RAIL_1},
+    {GENEVA, RAIL_1}, {FLORENCE, RAIL_1},
+    // MUNICH
+    {ZURICH, ROAD}, {ZAGREB, ROAD}, {VIENNA, ROAD}, {VENICE, ROAD},
+    {STRASBOURG, ROAD}, {NUREMBURG, ROAD}, {MILAN, ROAD}, {FRANKFURT, RAIL_3},
+    {BERLIN, RAIL_3}, {MUNICH, RAIL_2}, {LEIPZIG, RAIL_2}, {NUREMBURG, RAIL_1},
+    // NANTES
+    {BAY_OF_BISCAY, BOAT}, {PARIS, ROAD}, {LE_HAVRE, ROAD}, {CLERMONT_FERRAND, ROAD},
+    {BORDEAUX, ROAD},
+    // NAPLES
+    {TYRRHENIAN_SEA, BOAT}, {ROME, ROAD}, {BARI, ROAD}, {MILAN, RAIL_3},
+    {NAPLES, RAIL_2}, {FLORENCE, RAIL_2}, {ROME, RAIL_1}, {BARI, RAIL_1},
+    // NORTH_SEA
+    {HAMBURG, BOAT}, {ENGLISH_CHANNEL, BOAT}, {EDINBURGH, BOAT}, {ATLANTIC_OCEAN, BOAT},
+    {AMSTERDAM, BOAT},
+    // NUREMBURG
+    {STRASBOURG, ROAD}, {PRAGUE, ROAD}, {MUNICH, ROAD}, {LEIPZIG, ROAD},
+    {FRANKFURT, ROAD}, {STRASBOURG, RAIL_3}, {COLOGNE, RAIL_3}, {PRAGUE, RAIL_3},
+    {HAMBURG, RAIL_3}, {NUREMBURG, RAIL_2}, {FRANKFURT, RAIL_2}, {BERLIN, RAIL_2},
+    {MUNICH, RAIL_1}, {LEIPZIG, RAIL_1},
+    // PARIS
+    {STRASBOURG, ROAD}, {NANTES, ROAD}, {LE_HAVRE, ROAD}, {GENEVA, ROAD},
+    {CLERMONT_FERRAND, ROAD}, {BRUSSELS, ROAD}, {FRANKFURT, RAIL_3}, {MADRID, RAIL_3},
+    {BARCELONA, RAIL_3}, {PARIS, RAIL_2}, {COLOGNE, RAIL_2}, {SARAGOSSA, RAIL_2},
+    {MARSEILLES, RAIL_1}, {LE_HAVRE, RAIL_1}, {BRUSSELS, RAIL_1}, {BORDEAUX, RAIL_1},
+    // PLYMOUTH
+    {ENGLISH_CHANNEL, BOAT}, {LONDON, ROAD},
+    // PRAGUE
+    {VIENNA, ROAD}, {NUREMBURG, ROAD}, {BERLIN, ROAD}, {SZEGED, RAIL_3},
+    {NUREMBURG, RAIL_3}, {FRANKFURT, RAIL_3}, {VENICE, RAIL_2}, {PRAGUE, RAIL_2},
+    {BUDAPEST, RAIL_2}, {LEIPZIG, RAIL_2}, {HAMBURG, RAIL_2}, {VIENNA, RAIL_1},
+    {BERLIN, RAIL_1},
+    // ROME
+    {TYRRHENIAN_SEA, BOAT}, {NAPLES, ROAD}, {FLORENCE, ROAD}, {BARI, ROAD},
+    {ZURICH, RAIL_3}, {GENOA, RAIL_3}, {GENEVA, RAIL_3}, {ROME, RAIL_2},
+    {BARI, RAIL_2}, {MILAN, RAIL_2}, {NAPLES, RAIL_1}, {FLORENCE, RAIL_1},
+    // SALONICA
+    {IONIAN_SEA, BOAT}, {VALONA, ROAD}, {SOFIA, ROAD}, {SZEGED, RAIL_3},
+    {VARNA, RAIL_2}, {SALONICA, RAIL_2}, {BELGRADE, RAIL_2}, {SOFIA, RAIL_1},
+    // SANTANDER
+    {BAY_OF_BISCAY, BOAT}, {SARAGOSSA, ROAD}, {MADRID, ROAD}, {LISBON, ROAD},
+    {BORDEAUX, RAIL_3}, {BARCELONA, RAIL_3}, {SARAGOSSA, RAIL_2}, {SANTANDER, RAIL_2},
+    {LISBON, RAIL_2}, {ALICANTE, RAIL_2}, {MADRID, RAIL_1},
+    // SARAGOSSA
+    {TOULOUSE, ROAD}, {SANTANDER, ROAD}, {MADRID, ROAD}, {BORDEAUX, ROAD},
+    {BARCELONA, ROAD}, {ALICANTE, ROAD}, {MARSEILLES, RAIL_3}, {LE_HAVRE, RAIL_3},
+    {BRUSSELS, RAIL_3}, {SARAGOSSA, RAIL_2}, {SANTANDER, RAIL_2}, {LISBON, RAIL_2},
+    {ALICANTE, RAIL_2}, {PARIS, RAIL_2}, {MADRID, RAIL_1}, {BORDEAUX, RAIL_1},
+    {BARCELONA, RAIL_1},
+    // SARAJEVO
+    {ZAGREB, ROAD}, {VALONA, ROAD}, {ST_JOSEPH_AND_ST_MARYS, ROAD}, {SOFIA, ROAD},
+    {BELGRADE, ROAD},
+    // SOFIA
+    {VARNA, ROAD}, {VALONA, ROAD}, {SARAJEVO, ROAD}, {SALONICA, ROAD},
+    {BUCHAREST, ROAD}, {BELGRADE, ROAD}, {BUDAPEST, RAIL_3}, {BUCHAREST, RAIL_3},
+    {SOFIA, RAIL_2}, {SZEGED, RAIL_2}, {VARNA, RAIL_1}, {SALONICA, RAIL_1},
+    {BELGRADE, RAIL_1},
+    // ST_JOSEPH_AND_ST_MARYS
+    {ZAGREB, ROAD}, {SZEGED, ROAD}, {SARAJEVO, ROAD}, {BELGRADE, ROAD},
+    // STRASBOURG
+    {ZURICH, ROAD}, {PARIS, ROAD}, {NUREMBURG, ROAD}, {MUNICH, ROAD},
+    {GENEVA, ROAD}, {FRANKFURT, ROAD}, {COLOGNE, ROAD}, {BRUSSELS, ROAD},
+    {GENOA, RAIL_3}, {GENEVA, RAIL_3}, {FLORENCE, RAIL_3}, {NUREMBURG, RAIL_3},
+    {BERLIN, RAIL_3}, {BRUSSELS, RAIL_3}, {STRASBOURG, RAIL_2}, {MILAN, RAIL_2},
+    {LEIPZIG, RAIL_2}, {COLOGNE, RAIL_2}, {ZURICH, RAIL_1}, {FRANKFURT, RAIL_1},
+    // SWANSEA
+    {IRISH_SEA, BOAT}, {LONDON, ROAD}, {LIVERPOOL, ROAD},
+    // SZEGED
+    {ZAGREB, ROAD}, {ST_JOSEPH_AND_ST_MARYS, ROAD}, {KLAUSENBURG, ROAD}, {BUDAPEST, ROAD},
+    {BELGRADE, ROAD}, {VENICE, RAIL_3}, {PRAGUE, RAIL_3}, {VARNA, RAIL_3},
+    {SALONICA, RAIL_3}, {VIENNA, RAIL_2}, {SZEGED, RAIL_2}, {GALATZ, RAIL_2},
+    {CONSTANTA, RAIL_2}, {SOFIA, RAIL_2}, {BUDAPEST, RAIL_1}, {BUCHAREST, RAIL_1},
+    {BELGRADE, RAIL_1},
+    // TOULOUSE
+    {SARAGOSSA, ROAD}, {MARSEILLES, ROAD}, {CLERMONT_FERRAND, ROAD}, {BORDEAUX, ROAD},
+    {BARCELONA, ROAD},
+    // TYRRHENIAN_SEA
+    {ROME, BOAT}, {NAPLES, BOAT}, {MEDITERRANEAN_SEA, BOAT}, {IONIAN_SEA, BOAT},
+    {GENOA, BOAT}, {CAGLIARI, BOAT},
+    // VALONA
+    {IONIAN_SEA, BOAT}, {SOFIA, ROAD}, {SARAJEVO, ROAD}, {SALONICA, ROAD},
+    {ATHENS, ROAD},
+    // VARNA
+    {BLACK_SEA, BOAT}, {SOFIA, ROAD}, {CONSTANTA, ROAD}, {SZEGED, RAIL_3},
+    {VARNA, RAIL_2}, {SALONICA, RAIL_2}, {BELGRADE, RAIL_2}, {SOFIA, RAIL_1},
+    // VENICE
+    {ADRIATIC_SEA, BOAT}, {MUNICH, ROAD}, {MILAN, ROAD}, {GENOA, ROAD},
+    {FLORENCE, ROAD}, {BERLIN, RAIL_3}, {SZEGED, RAIL_3}, {VENICE, RAIL_2},
+    {PRAGUE, RAIL_2}, {BUDAPEST, RAIL_2}, {VIENNA, RAIL_1},
+    // VIENNA
+    {ZAGREB, ROAD}, {PRAGUE, ROAD}, {MUNICH, ROAD}, {BUDAPEST, ROAD},
+    {LEIPZIG, RAIL_3}, {HAMBURG, RAIL_3}, {BUCHAREST, RAIL_3}, {BELGRADE, RAIL_3},
+    {VIENNA, RAIL_2}, {BERLIN, RAIL_2}, {SZEGED, RAIL_2}, {VENICE, RAIL_1},
+    {PRAGUE, RAIL_1}, {BUDAPEST, RAIL_1},
+    // ZAGREB
+    {VIENNA, ROAD}, {SZEGED, ROAD}, {ST_JOSEPH_AND_ST_MARYS, ROAD}, {SARAJEVO, ROAD},
+    {MUNICH, ROAD}, {BUDAPEST, ROAD},
+    // ZURICH
+    {STRASBOURG, ROAD}, {MUNICH, ROAD}, {MILAN, ROAD}, {MARSEILLES, ROAD},
+    {GENEVA, ROAD}, {LEIPZIG, RAIL_3}, {COLOGNE, RAIL_3}, {ROME, RAIL_3},
+    {ZURICH, RAIL_2}, {FRANKFURT, RAIL_2}, {GENOA, RAIL_2}, {GENEVA, RAIL_2},
+    {FLORENCE, RAIL_2}, {STRASBOURG, RAIL_1}, {MILAN, RAIL_1},
+    // FULL_GRAPH
+    // ADRIATIC_SEA
+    {VENICE, BOAT}, {IONIAN_SEA, BOAT}, {BARI, BOAT},
+    // ALICANTE
+    {MEDITERRANEAN_SEA, BOAT}, {MADRID, RAIL}, {BARCELONA, RAIL}, {SARAGOSSA, ROAD},
+    {MADRID, ROAD}, {GRANADA, ROAD},
+    // AMSTERDAM
+    {NORTH_SEA, BOAT}, {COLOGNE, ROAD}, {BRUSSELS, ROAD},
+    // ATHENS
+    {IONIAN_SEA, BOAT}, {VALONA, ROAD},
+    // ATLANTIC_OCEAN
+    {NORTH_SEA, BOAT}, {MEDITERRANEAN_SEA, BOAT}, {LISBON, BOAT}, {IRISH_SEA, BOAT},
+    {GALWAY, BOAT}, {ENGLISH_CHANNEL, BOAT}, {CADIZ, BOAT}, {BAY_OF_BISCAY, BOAT},
+    // BARCELONA
+    {MEDITERRANEAN_SEA, BOAT}, {SARAGOSSA, RAIL}, {ALICANTE, RAIL}, {TOULOUSE, ROAD},
+    {SARAGOSSA, ROAD},
+    // BARI
+    {ADRIATIC_SEA, BOAT}, {NAPLES, RAIL}, {ROME, ROAD}, {NAPLES, ROAD},
+    // BAY_OF_BISCAY
+    {SANTANDER, BOAT}, {NANTES, BOAT}, {BORDEAUX, BOAT}, {ATLANTIC_OCEAN, BOAT},
+    // BELGRADE
+    {SZEGED, RAIL}, {SOFIA, RAIL}, {SZEGED, ROAD}, {ST_JOSEPH_AND_ST_MARYS, ROAD},
+    {SOFIA, ROAD}, {SARAJEVO, ROAD}, {KLAUSENBURG, ROAD}, {BUCHAREST, ROAD},
+    // BERLIN
+    {PRAGUE, RAIL}, {LEIPZIG, RAIL}, {HAMBURG, RAIL}, {PRAGUE, ROAD},
+    {LEIPZIG, ROAD}, {HAMBURG, ROAD},
+    // BLACK_SEA
+    {VARNA, BOAT}, {IONIAN_SEA, BOAT}, {CONSTANTA, BOAT},
+    // BORDEAUX
+    {BAY_OF_BISCAY, BOAT}, {SARAGOSSA, RAIL}, {PARIS, RAIL}, {TOULOUSE, ROAD},
+    {SARAGOSSA, ROAD}, {NANTES, ROAD}, {CLERMONT_FERRAND, ROAD},
+    // BRUSSELS
+    {PARIS, RAIL}, {COLOGNE, RAIL}, {STRASBOURG, ROAD}, {PARIS, ROAD},
+    {LE_HAVRE, ROAD}, {COLOGNE, ROAD}, {AMSTERDAM, ROAD},
+    // BUCHAREST
+    {SZEGED, RAIL}, {GALATZ, RAIL}, {CONSTANTA, RAIL}, {SOFIA, ROAD},
+    {KLAUSENBURG, ROAD}, {GALATZ, ROAD}, {CONSTANTA, ROAD}, {BELGRADE, ROAD},
+    // BUDAPEST
+    {VIENNA, RAIL}, {SZEGED, RAIL}, {ZAGREB, ROAD}, {VIENNA, ROAD},
+    {SZEGED, ROAD}, {KLAUSENBURG, ROAD},
+    // CADIZ
+    {ATLANTIC_OCEAN, BOAT}, {MADRID, ROAD}, {LISBON, ROAD}, {GRANADA, ROAD},
+    // CAGLIARI
+    {TYRRHENIAN_SEA, BOAT}, {MEDITERRANEAN_SEA, BOAT},
+    // CASTLE_DRACULA
+    {KLAUSENBURG, ROAD}, {GALATZ, ROAD},
+    // CLERMONT_FERRAND
+    {TOULOUSE, ROAD}, {PARIS, ROAD}, {NANTES, ROAD}, {MARSEILLES, ROAD},
+    {GENEVA, ROAD}, {BORDEAUX, ROAD},
+    // COLOGNE
+    {FRANKFURT, RAIL}, {BRUSSELS, RAIL}, {STRASBOURG, ROAD}, {LEIPZIG, ROAD},
+    {HAMBURG, ROAD}, {FRANKFURT, ROAD}, {BRUSSELS, ROAD}, {AMSTERDAM, ROAD},
+    // CONSTANTA
+    {BLACK_SEA, BOAT}, {BUCHAREST, RAIL}, {VARNA, ROAD}, {GALATZ, ROAD},
+    {BUCHAREST, ROAD},
+    // DUBLIN
+    {IRISH_SEA, BOAT}, {GALWAY, ROAD},
+    // EDINBURGH
+    {NORTH_SEA, BOAT}, {MANCHESTER, RAIL}, {MANCHESTER, ROAD},
+    // ENGLISH_CHANNEL
+    {PLYMOUTH, BOAT}, {NORTH_SEA, BOAT}, {LONDON, BOAT}, {LE_HAVRE, BOAT},
+    {ATLANTIC_OCEAN, BOAT},
+    // FLORENCE
+    {ROME, RAIL}, {MILAN, RAIL}, {VENICE, ROAD}, {ROME, ROAD},
+    {GENOA, ROAD},
+    // FRANKFURT
+    {STRASBOURG, RAIL}, {LEIPZIG, RAIL}, {COLOGNE, RAIL}, {STRASBOURG, ROAD},
+    {NUREMBURG, ROAD}, {LEIPZIG, ROAD}, {COLOGNE, ROAD},
+    // GALATZ
+    {BUCHAREST, RAIL}, {KLAUSENBURG, ROAD}, {CONSTANTA, ROAD}, {CASTLE_DRACULA, ROAD},
+    {BUCHAREST, ROAD},
+    // GALWAY
+    {ATLANTIC_OCEAN, BOAT}, {DUBLIN, ROAD},
+    // GENEVA
+    {MILAN, RAIL}, {ZURICH, ROAD}, {STRASBOURG, ROAD}, {PARIS, ROAD},
+    {MARSEILLES, ROAD}, {CLERMONT_FERRAND, ROAD},
+    // GENOA
+    {TYRRHENIAN_SEA, BOAT}, {MILAN, RAIL}, {VENICE, ROAD}, {MILAN, ROAD},
+    {MARSEILLES, ROAD}, {FLORENCE, ROAD},
+    // GRANADA
+    {MADRID, ROAD}, {CADIZ, ROAD}, {ALICANTE, ROAD},
+    // HAMBURG
+    {NORTH_SEA, BOAT}, {BERLIN, RAIL}, {LEIPZIG, ROAD}, {COLOGNE, ROAD},
+    {BERLIN, ROAD},
+    // IONIAN_SEA
+    {VALONA, BOAT}, {TYRRHENIAN_SEA, BOAT}, {SALONICA, BOAT}, {BLACK_SEA, BOAT},
+    {ATHENS, BOAT}, {ADRIATIC_SEA, BOAT},
+    // IRISH_SEA
+    {SWANSEA, BOAT}, {LIVERPOOL, BOAT}, {DUBLIN, BOAT}, {ATLANTIC_OCEAN, BOAT},
+    // KLAUSENBURG
+    {SZEGED, ROAD}, {GALATZ, ROAD}, {CASTLE_DRACULA, ROAD}, {BUDAPEST, ROAD},
+    {BUCHAREST, ROAD}, {BELGRADE, ROAD},
+    // LE_HAVRE
+    {ENGLISH_CHANNEL, BOAT}, {PARIS, RAIL}, {PARIS, ROAD}, {NANTES, ROAD},
+    {BRUSSELS, ROAD},
+    // LEIPZIG
+    {NUREMBURG, RAIL}, {FRANKFURT, RAIL}, {BERLIN, RAIL}, {NUREMBURG, ROAD},
+    {HAMBURG, ROAD}, {FRANKFURT, ROAD}, {COLOGNE, ROAD}, {BERLIN, ROAD},
+    // LISBON
+    {ATLANTIC_OCEAN, BOAT}, {MADRID, RAIL}, {SANTANDER, ROAD}, {MADRID, ROAD},
+    {CADIZ, ROAD},
+    // LIVERPOOL
+    {IRISH_SEA, BOAT}, {MANCHESTER, RAIL}, {SWANSEA, ROAD}, {MANCHESTER, ROAD},
+    // LONDON
+    {ENGLISH_CHANNEL, BOAT}, {SWANSEA, RAIL}, {MANCHESTER, RAIL}, {SWANSEA, ROAD},
+    {PLYMOUTH, ROAD}, {MANCHESTER, ROAD},
+    // MADRID
+    {SARAGOSSA, RAIL}, {SANTANDER, RAIL}, {LISBON, RAIL}, {ALICANTE, RAIL},
+    {SARAGOSSA, ROAD}, {SANTANDER, ROAD}, {LISBON, ROAD}, {GRANADA, ROAD},
+    {CADIZ, ROAD}, {ALICANTE, ROAD},
+    // MANCHESTER
+    {LONDON, RAIL}, {LIVERPOOL, RAIL}, {EDINBURGH, RAIL}, {LONDON, ROAD},
+    {LIVERPOOL, ROAD}, {EDINBURGH, ROAD},
+    // MARSEILLES
+    {MEDITERRANEAN_SEA, BOAT}, {PARIS, RAIL}, {ZURICH, ROAD}, {TOULOUSE, ROAD},
+    {MILAN, ROAD}, {GENOA, ROAD}, {GENEVA, ROAD}, {CLERMONT_FERRAND, ROAD},
+    // MEDITERRANEAN_SEA
+    {TYRRHENIAN_SEA, BOAT}, {MARSEILLES, BOAT}, {CAGLIARI, BOAT}, {BARCELONA, BOAT},
+    {ATLANTIC_OCEAN, BOAT}, {ALICANTE, BOAT},
+    // MILAN
+    {ZURICH, RAIL}, {GENOA, RAIL}, {GENEVA, RAIL}, {FLORENCE, RAIL},
+    {ZURICH, ROAD}, {VENICE, ROAD}, {MUNICH, ROAD}, {MARSEILLES, ROAD},
+    {GENOA, ROAD},
+    // MUNICH
+    {NUREMBURG, RAIL}, {ZURICH, ROAD}, {ZAGREB, ROAD}, {VIENNA, ROAD},
+    {VENICE, ROAD}, {STRASBOURG, ROAD}, {NUREMBURG, ROAD}, {MILAN, ROAD},
+    // NANTES
+    {BAY_OF_BISCAY, BOAT}, {PARIS, ROAD}, {LE_HAVRE, ROAD}, {CLERMONT_FERRAND, ROAD},
+    {BORDEAUX, ROAD},
+    // NAPLES
+    {TYRRHENIAN_SEA, BOAT}, {ROME, RAIL}, {BARI, RAIL}, {ROME, ROAD},
+    {BARI, ROAD},
+    // NORTH_SEA
+    {HAMBURG, BOAT}, {ENGLISH_CHANNEL, BOAT}, {EDINBURGH, BOAT}, {ATLANTIC_OCEAN, BOAT},
+    {AMSTERDAM, BOAT},
+    // NUREMBURG
+    {MUNICH, RAIL}, {LEIPZIG, RAIL}, {STRASBOURG, ROAD}, {PRAGUE, ROAD},
+    {MUNICH, ROAD}, {LEIPZIG, ROAD}, {FRANKFURT, ROAD},
+    // PARIS
+    {MARSEILLES, RAIL}, {LE_HAVRE, RAIL}, {BRUSSELS, RAIL}, {BORDEAUX, RAIL},
+    {STRASBOURG, ROAD}, {NANTES, ROAD}, {LE_HAVRE, ROAD}, {GENEVA, ROAD},
+    {CLERMONT_FERRAND, ROAD}, {BRUSSELS, ROAD},
+    // PLYMOUTH
+    {ENGLISH_CHANNEL, BOAT}, {LONDON, ROAD},
+    // PRAGUE
+    {VIENNA, RAIL}, {BERLIN, RAIL}, {VIENNA, ROAD}, {NUREMBURG, ROAD},
+    {BERLIN, ROAD},
+    // ROME
+    {TYRRHENIAN_SEA, BOAT}, {NAPLES, RAIL}, {FLORENCE, RAIL}, {NAPLES, ROAD},
+    {FLORENCE, ROAD}, {BARI, ROAD},
+    // SALONICA
+    {IONIAN_SEA, BOAT}, {SOFIA, RAIL}, {VALONA, ROAD}, {SOFIA, ROAD},
+    // SANTANDER
+    {BAY_OF_BISCAY, BOAT}, {MADRID, RAIL}, {SARAGOSSA, ROAD}, {MADRID, ROAD},
+    {LISBON, ROAD},
+    // SARAGOSSA
+    {MADRID, RAIL}, {BORDEAUX, RAIL}, {BARCELONA, RAIL}, {TOULOUSE, ROAD},
+    {SANTANDER, ROAD}, {MADRID, ROAD}, {BORDEAUX, ROAD}, {BARCELONA, ROAD},
+    {ALICANTE, ROAD},
+    // SARAJEVO
+    {ZAGREB, ROAD}, {VALONA, ROAD}, {ST_JOSEPH_AND_ST_MARYS, ROAD}, {SOFIA, ROAD},
+    {BELGRADE, ROAD},
+    // SOFIA
+    {VARNA, RAIL}, {SALONICA, RAIL}, {BELGRADE, RAIL}, {VARNA, ROAD},
+    {VALONA, ROAD}, {SARAJEVO, ROAD}, {SALONICA, ROAD}, {BUCHAREST, ROAD},
+    {BELGRADE, ROAD},
+    // ST_JOSEPH_AND_ST_MARYS
+    {ZAGREB, ROAD}, {SZEGED, ROAD}, {SARAJEVO, ROAD}, {BELGRADE, ROAD},
+    // STRASBOURG
+    {ZURICH, RAIL}, {FRANKFURT, RAIL}, {ZURICH, ROAD}, {PARIS, ROAD},
+    {NUREMBURG, ROAD}, {MUNICH, ROAD}, {GENEVA, ROAD}, {FRANKFURT, ROAD},
+    {COLOGNE, ROAD}, {BRUSSELS, ROAD},
+    // SWANSEA
+    {IRISH_SEA, BOAT}, {LONDON, RAIL}, {LONDON, ROAD}, {LIVERPOOL, ROAD},
+    // SZEGED
+    {BUDAPEST, RAIL}, {BUCHAREST, RAIL}, {BELGRADE, RAIL}, {ZAGREB, ROAD},
+    {ST_JOSEPH_AND_ST_MARYS, ROAD}, {KLAUSENBURG, ROAD}, {BUDAPEST, ROAD}, {BELGRADE, ROAD},
+    // TOULOUSE
+    {SARAGOSSA, ROAD}, {MARSEILLES, ROAD}, {CLERMONT_FERRAND, ROAD}, {BORDEAUX, ROAD},
+    {BARCELONA, ROAD},
+    // TYRRHENIAN_SEA
+    {ROME, BOAT}, {NAPLES, BOAT}, {MEDITERRANEAN_SEA, BOAT}, {IONIAN_SEA, BOAT},
+    {GENOA, BOAT}, {CAGLIARI, BOAT},
+    // VALONA
+    {IONIAN_SEA, BOAT}, {SOFIA, ROAD}, {SARAJEVO, ROAD}, {SALONICA, ROAD},
+    {ATHENS, ROAD},
+    // VARNA
+    {BLACK_SEA, BOAT}, {SOFIA, RAIL}, {SOFIA, ROAD}, {CONSTANTA, ROAD},
+    // VENICE
+    {ADRIATIC_SEA, BOAT}, {VIENNA, RAIL}, {MUNICH, ROAD}, {MILAN, ROAD},
+    {GENOA, ROAD}, {FLORENCE, ROAD},
+    // VIENNA
+    {VENICE, RAIL}, {PRAGUE, RAIL}, {BUDAPEST, RAIL}, {ZAGREB, ROAD},
+    {PRAGUE, ROAD}, {MUNICH, ROAD}, {BUDAPEST, ROAD},
+    // ZAGREB
+    {VIENNA, ROAD}, {SZEGED, ROAD}, {ST_JOSEPH_AND_ST_MARYS, ROAD}, {SARAJEVO, ROAD},
+    {MUNICH, ROAD}, {BUDAPEST, ROAD},
+    // ZURICH
+    {STRASBOURG, RAIL}, {MILAN, RAIL}, {STRASBOURG, ROAD}, {MUNICH, ROAD},
+    {MILAN, ROAD}, {MARSEILLES, ROAD}, {GENEVA, ROAD},
+    // RAIL_GRAPH
+    // ALICANTE
+    {MADRID, RAIL}, {BARCELONA, RAIL},
+    // BARCELONA
+    {SARAGOSSA, RAIL}, {ALICANTE, RAIL},
+    // BARI
+    {NAPLES, RAIL},
+    // BELGRADE
+    {SZEGED, RAIL}, {SOFIA, RAIL},
+    // BERLIN
+    {PRAGUE, RAIL}, {LEIPZIG, RAIL}, {HAMBURG, RAIL},
+    // BORDEAUX
+    {SARAGOSSA, RAIL}, {PARIS, RAIL},
+    // BRUSSELS
+    {PARIS, RAIL}, {COLOGNE, RAIL},
+    // BUCHAREST
+    {SZEGED, RAIL}, {GALATZ, RAIL}, {CONSTANTA, RAIL},
+    // BUDAPEST
+    {VIENNA, RAIL}, {SZEGED, RAIL},
+    // COLOGNE
+    {FRANKFURT, RAIL}, {BRUSSELS, RAIL},
+    // CONSTANTA
+    {BUCHAREST, RAIL},
+    // EDINBURGH
+    {MANCHESTER, RAIL},
+    // FLORENCE
+    {ROME, RAIL}, {MILAN, RAIL},
+    // FRANKFURT
+    {STRASBOURG, RAIL}, {LEIPZIG, RAIL}, {COLOGNE, RAIL},
+    // GALATZ
+    {BUCHAREST, RAIL},
+    // GENEVA
+    {MILAN, RAIL},
+    // GENOA
+    {MILAN, RAIL},
+    // HAMBURG
+    {BERLIN, RAIL},
+    // LE_HAVRE
+    {PARIS, RAIL},
+    // LEIPZIG
+    {NUREMBURG, RAIL}, {FRANKFURT, RAIL}, {BERLIN, RAIL},
+    // LISBON
+    {MADRID, RAIL},
+    // LIVERPOOL
+    {MANCHESTER, RAIL},
+    // LONDON
+    {SWANSEA, RAIL}, {MANCHESTER, RAIL},
+    // MADRID
+    {SARAGOSSA, RAIL}, {SANTANDER, RAIL}, {LISBON, RAIL}, {ALICANTE, RAIL},
+    // MANCHESTER
+    {LONDON, RAIL}, {LIVERPOOL, RAIL}, {EDINBURGH, RAIL},
+    // MARSEILLES
+    {PARIS, RAIL},
+    // MILAN
+    {ZURICH, RAIL}, {GENOA, RAIL}, {GENEVA, RAIL}, {FLORENCE, RAIL},
+    // MUNICH
+    {NUREMBURG, RAIL},
+    // NAPLES
+    {ROME, RAIL}, {BARI, RAIL},
+    // NUREMBURG
+    {MUNICH, RAIL}, {LEIPZIG, RAIL},
+    // PARIS
+    {MARSEILLES, RAIL}, {LE_HAVRE, RAIL}, {BRUSSELS, RAIL}, {BORDEAUX, RAIL},
+    // PRAGUE
+    {VIENNA, RAIL}, {BERLIN, RAIL},
+    // ROME
+    {NAPLES, RAIL}, {FLORENCE, RAIL},
+    // SALONICA
+    {SOFIA, RAIL},
+    // SANTANDER
+    {MADRID, RAIL},
+    // SARAGOSSA
+    {MADRID, RAIL}, {BORDEAUX, RAIL}, {BARCELONA, RAIL},
+    // SOFIA
+    {VARNA, RAIL}, {SALONICA, RAIL}, {BELGRADE, RAIL},
+    // STRASBOURG
+    {ZURICH, RAIL}, {FRANKFURT, RAIL},
+    // SWANSEA
+    {LONDON, RAIL},
+    // SZEGED
+    {BUDAPEST, RAIL}, {BUCHAREST, RAIL}, {BELGRADE, RAIL},
+    // VARNA
+    {SOFIA, RAIL},
+    // VENICE
+    {VIENNA, RAIL},
+    // VIENNA
+    {VENICE, RAIL}, {PRAGUE, RAIL}, {BUDAPEST, RAIL},
+    // ZURICH
+    {STRASBOURG, RAIL}, {MILAN, RAIL},
+};
+
+static const int mapOffsets[NUM_MAP_KINDS][NUM_MAP_LOCATIONS + 1] = {
+    // BASIC_MAP
+    {   0,    3,    7,   10,   12,   20,   23,   26,   30,   36,   39,   42,
+       47,   52,   57,   61,   65,   67,   69,   75,   81,   85,   87,   89,
+       94,   97,  101,  105,  107,  112,  117,  120,  124,  130,  134,  140,
+      144,  149,  153,  156,  160,  166,  169,  176,  182,  187,  194,  199,
+      202,  207,  212,  218,  220,  223,  227,  230,  234,  240,  245,  251,
+      255,  263,  266,  271,  276,  282,  287,  290,  295,  299,  305,  310},
+    // ONE_RAIL_MAP
+    { 310,  313,  319,  322,  324,  332,  337,  341,  345,  353,  359,  362,
+      369,  376,  384,  390,  394,  396,  398,  404,  412,  417,  419,  422,
+      427,  432,  439,  444,  446,  452,  458,  461,  466,  472,  476,  482,
+      487,  495,  500,  504,  510,  520,  526,  534,  540,  549,  557,  562,
+      567,  572,  579,  589,  591,  596,  602,  606,  611,  620,  625,  634,
+      638,  648,  652,  660,  665,  671,  676,  680,  686,  693,  699,  706},
+    // RAIL_MAP
+    { 706,  709,  720,  723,  725,  733,  744,  751,  755,  771,  786,  789,
+      806,  821,  834,  849,  853,  855,  857,  863,  881,  891,  893,  900,
+      905,  917,  934,  944,  946,  958,  970,  973,  984,  990,  994, 1000,
+     1011, 1028, 1039, 1047, 1051, 1065, 1068, 1082, 1088, 1102, 1114, 1119,
+     1127, 1132, 1146, 1162, 1164, 1177, 1189, 1197, 1208, 1225, 1230, 1243,
+     1247, 1267, 1270, 1287, 1292, 1298, 1303, 1311, 1322, 1336, 1342, 1357},
+    // FULL_GRAPH
+    {1357, 1360, 1366, 1369, 1371, 1379, 1384, 1388, 1392, 1400, 1406, 1409,
+     1416, 1423, 1431, 1437, 1441, 1443, 1445, 1451, 1459, 1464, 1466, 1469,
+     1474, 1479, 1486, 1491, 1493, 1499, 1505, 1508, 1513, 1519, 1523, 1529,
+     1534, 1542, 1547, 1551, 1557, 1567, 1573, 1581, 1587, 1596, 1604, 1609,
+     1614, 1619, 1626, 1636, 1638, 1643, 1649, 1653, 1658, 1667, 1672, 1681,
+     1685, 1695, 1699, 1707, 1712, 1718, 1723, 1727, 1733, 1740, 1746, 1753},
+    // RAIL_GRAPH
+    {1753, 1753, 1755, 1755, 1755, 1755, 1757, 1758, 1758, 1760, 1763, 1763,
+     1765, 1767, 1770, 1772, 1772, 1772, 1772, 1772, 1774, 1775, 1775, 1776,
+     1776, 1778, 1781, 1782, 1782, 1783, 1784, 1784, 1785, 1785, 1785, 1785,
+     1786, 1789, 1790, 1791, 1793, 1797, 1800, 1801, 1801, 1805, 1806, 1806,
+     1808, 1808, 1810, 1814, 1814, 1816, 1818, 1819, 1820, 1823, 1823, 1826,
+     1826, 1828, 1829, 1832, 1832, 1832, 1832, 1833, 1834, 1837, 1837, 1839},
+};
+
+// each place's type and how many places it is connected to by each
+//  kind of transport
+static const MapPlace mapPlaces[NUM_MAP_LOCATIONS] = {
+    {SEA,   0,  0,  3},    // ADRIATIC_SEA
+    {LAND,  3,  2,  1},    // ALICANTE
+    {LAND,  2,  0,  1},    // AMSTERDAM
+    {LAND,  1,  0,  1},    // ATHENS
+    {SEA,   0,  0,  8},    // ATLANTIC_OCEAN
+    {LAND,  2,  2,  1},    // BARCELONA
+    {LAND,  2,  1,  1},    // BARI
+    {SEA,   0,  0,  4},    // BAY_OF_BISCAY
+    {LAND,  6,  2,  0},    // BELGRADE
+    {LAND,  3,  3,  0},    // BERLIN
+    {SEA,   0,  0,  3},    // BLACK_SEA
+    {LAND,  4,  2,  1},    // BORDEAUX
+    {LAND,  5,  2,  0},    // BRUSSELS
+    {LAND,  5,  3,  0},    // BUCHAREST
+    {LAND,  4,  2,  0},    // BUDAPEST
+    {LAND,  3,  0,  1},    // CADIZ
+    {LAND,  0,  0,  2},    // CAGLIARI
+    {LAND,  2,  0,  0},    // CASTLE_DRACULA
+    {LAND,  6,  0,  0},    // CLERMONT_FERRAND
+    {LAND,  6,  2,  0},    // COLOGNE
+    {LAND,  3,  1,  1},    // CONSTANTA
+    {LAND,  1,  0,  1},    // DUBLIN
+    {LAND,  1,  1,  1},    // EDINBURGH
+    {SEA,   0,  0,  5},    // ENGLISH_CHANNEL
+    {LAND,  3,  2,  0},    // FLORENCE
+    {LAND,  4,  3,  0},    // FRANKFURT
+    {LAND,  4,  1,  0},    // GALATZ
+    {LAND,  1,  0,  1},    // GALWAY
+    {LAND,  5,  1,  0},    // GENEVA
+    {LAND,  4,  1,  1},    // GENOA
+    {LAND,  3,  0,  0},    // GRANADA
+    {LAND,  3,  1,  1},    // HAMBURG
+    {SEA,   0,  0,  6},    // IONIAN_SEA
+    {SEA,   0,  0,  4},    // IRISH_SEA
+    {LAND,  6,  0,  0},    // KLAUSENBURG
+    {LAND,  3,  1,  1},    // LE_HAVRE
+    {LAND,  5,  3,  0},    // LEIPZIG
+    {LAND,  3,  1,  1},    // LISBON
+    {LAND,  2,  1,  1},    // LIVERPOOL
+    {LAND,  3,  2,  1},    // LONDON
+    {LAND,  6,  4,  0},    // MADRID
+    {LAND,  3,  3,  0},    // MANCHESTER
+    {LAND,  6,  1,  1},    // MARSEILLES
+    {SEA,   0,  0,  6},    // MEDITERRANEAN_SEA
+    {LAND,  5,  4,  0},    // MILAN
+    {LAND,  7,  1,  0},    // MUNICH
+    {LAND,  4,  0,  1},    // NANTES
+    {LAND,  2,  2,  1},    // NAPLES
+    {SEA,   0,  0,  5},    // NORTH_SEA
+    {LAND,  5,  2,  0},    // NUREMBURG
+    {LAND,  6,  4,  0},    // PARIS
+    {LAND,  1,  0,  1},    // PLYMOUTH
+    {LAND,  3,  2,  0},    // PRAGUE
+    {LAND,  3,  2,  1},    // ROME
+    {LAND,  2,  1,  1},    // SALONICA
+    {LAND,  3,  1,  1},    // SANTANDER
+    {LAND,  6,  3,  0},    // SARAGOSSA
+    {LAND,  5,  0,  0},    // SARAJEVO
+    {LAND,  6,  3,  0},    // SOFIA
+    {LAND,  4,  0,  0},    // ST_JOSEPH_AND_ST_MARYS
+    {LAND,  8,  2,  0},    // STRASBOURG
+    {LAND,  2,  1,  1},    // SWANSEA
+    {LAND,  5,  3,  0},    // SZEGED
+    {LAND,  5,  0,  0},    // TOULOUSE
+    {SEA,   0,  0,  6},    // TYRRHENIAN_SEA
+    {LAND,  4,  0,  1},    // VALONA
+    {LAND,  2,  1,  1},    // VARNA
+    {LAND,  4,  1,  1},    // VENICE
+    {LAND,  4,  3,  0},    // VIENNA
+    {LAND,  6,  0,  0},    // ZAGREB
+    {LAND,  5,  2,  0},    // ZURICH
+};
+
+#endif
+
+#ifdef MAPDATA_MASKS
+
+// the places each place is connected to directly by ROAD, RAIL and BOAT
+//  (in LocSet.h's layout: bit p % 64 of word p / 64 is place p)
+static const LocSet mapNeighbours[MAX_TRANSPORT + 1][NUM_MAP_LOCATIONS] = {
+    [ROAD] = {
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // ADRIATIC_SEA
+        {{0x0100010040000000ULL, 0x0000000000000000ULL}},    // ALICANTE
+        {{0x0000000000081000ULL, 0x0000000000000000ULL}},    // AMSTERDAM
+        {{0x0000000000000000ULL, 0x0000000000000002ULL}},    // ATHENS
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // ATLANTIC_OCEAN
+        {{0x8100000000000000ULL, 0x0000000000000000ULL}},    // BARCELONA
+        {{0x0020800000000000ULL, 0x0000000000000000ULL}},    // BARI
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // BAY_OF_BISCAY
+        {{0x4e00000400002000ULL, 0x0000000000000000ULL}},    // BELGRADE
+        {{0x0010001080000000ULL, 0x0000000000000000ULL}},    // BERLIN
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // BLACK_SEA
+        {{0x8100400000040000ULL, 0x0000000000000000ULL}},    // BORDEAUX
+        {{0x1004000800080004ULL, 0x0000000000000000ULL}},    // BRUSSELS
+        {{0x0400000404100100ULL, 0x0000000000000000ULL}},    // BUCHAREST
+        {{0x4000000400000000ULL, 0x0000000000000030ULL}},    // BUDAPEST
+        {{0x0000012040000000ULL, 0x0000000000000000ULL}},    // CADIZ
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // CAGLIARI
+        {{0x0000000404000000ULL, 0x0000000000000000ULL}},    // CASTLE_DRACULA
+        {{0x8004440010000800ULL, 0x0000000000000000ULL}},    // CLERMONT_FERRAND
+        {{0x1000001082001004ULL, 0x0000000000000000ULL}},    // COLOGNE
+        {{0x0000000004002000ULL, 0x0000000000000004ULL}},    // CONSTANTA
+        {{0x0000000008000000ULL, 0x0000000000000000ULL}},    // DUBLIN
+        {{0x0000020000000000ULL, 0x0000000000000000ULL}},    // EDINBURGH
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // ENGLISH_CHANNEL
+        {{0x0020000020000000ULL, 0x0000000000000008ULL}},    // FLORENCE
+        {{0x1002001000080000ULL, 0x0000000000000000ULL}},    // FRANKFURT
+        {{0x0000000400122000ULL, 0x0000000000000000ULL}},    // GALATZ
+        {{0x0000000000200000ULL, 0x0000000000000000ULL}},    // GALWAY
+        {{0x1004040000040000ULL, 0x0000000000000040ULL}},    // GENEVA
+        {{0x0000140001000000ULL, 0x0000000000000008ULL}},    // GENOA
+        {{0x0000010000008002ULL, 0x0000000000000000ULL}},    // GRANADA
+        {{0x0000001000080200ULL, 0x0000000000000000ULL}},    // HAMBURG
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // IONIAN_SEA
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // IRISH_SEA
+        {{0x4000000004026100ULL, 0x0000000000000000ULL}},    // KLAUSENBURG
+        {{0x0004400000001000ULL, 0x0000000000000000ULL}},    // LE_HAVRE
+        {{0x0002000082080200ULL, 0x0000000000000000ULL}},    // LEIPZIG
+        {{0x0080010000008000ULL, 0x0000000000000000ULL}},    // LISBON
+        {{0x2000020000000000ULL, 0x0000000000000000ULL}},    // LIVERPOOL
+        {{0x2008020000000000ULL, 0x0000000000000000ULL}},    // LONDON
+        {{0x0180002040008002ULL, 0x0000000000000000ULL}},    // MADRID
+        {{0x000000c000400000ULL, 0x0000000000000000ULL}},    // MANCHESTER
+        {{0x8000100030040000ULL, 0x0000000000000040ULL}},    // MARSEILLES
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // MEDITERRANEAN_SEA
+        {{0x0000240020000000ULL, 0x0000000000000048ULL}},    // MILAN
+        {{0x1002100000000000ULL, 0x0000000000000078ULL}},    // MUNICH
+        {{0x0004000800040800ULL, 0x0000000000000000ULL}},    // NANTES
+        {{0x0020000000000040ULL, 0x0000000000000000ULL}},    // NAPLES
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // NORTH_SEA
+        {{0x1010201002000000ULL, 0x0000000000000000ULL}},    // NUREMBURG
+        {{0x1000400810041000ULL, 0x0000000000000000ULL}},    // PARIS
+        {{0x0000008000000000ULL, 0x0000000000000000ULL}},    // PLYMOUTH
+        {{0x0002000000000200ULL, 0x0000000000000010ULL}},    // PRAGUE
+        {{0x0000800001000040ULL, 0x0000000000000000ULL}},    // ROME
+        {{0x0400000000000000ULL, 0x0000000000000002ULL}},    // SALONICA
+        {{0x0100012000000000ULL, 0x0000000000000000ULL}},    // SANTANDER
+        {{0x8080010000000822ULL, 0x0000000000000000ULL}},    // SARAGOSSA
+        {{0x0c00000000000100ULL, 0x0000000000000022ULL}},    // SARAJEVO
+        {{0x0240000000002100ULL, 0x0000000000000006ULL}},    // SOFIA
+        {{0x4200000000000100ULL, 0x0000000000000020ULL}},    // ST_JOSEPH_AND_ST_MARYS
+        {{0x0006200012081000ULL, 0x0000000000000040ULL}},    // STRASBOURG
+        {{0x000000c000000000ULL, 0x0000000000000000ULL}},    // SWANSEA
+        {{0x0800000400004100ULL, 0x0000000000000020ULL}},    // SZEGED
+        {{0x0100040000040820ULL, 0x0000000000000000ULL}},    // TOULOUSE
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // TYRRHENIAN_SEA
+        {{0x0640000000000008ULL, 0x0000000000000000ULL}},    // VALONA
+        {{0x0400000000100000ULL, 0x0000000000000000ULL}},    // VARNA
+        {{0x0000300021000000ULL, 0x0000000000000000ULL}},    // VENICE
+        {{0x0010200000004000ULL, 0x0000000000000020ULL}},    // VIENNA
+        {{0x4a00200000004000ULL, 0x0000000000000010ULL}},    // ZAGREB
+        {{0x1000340010000000ULL, 0x0000000000000000ULL}},    // ZURICH
+    },
+    [RAIL] = {
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // ADRIATIC_SEA
+        {{0x0000010000000020ULL, 0x0000000000000000ULL}},    // ALICANTE
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // AMSTERDAM
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // ATHENS
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // ATLANTIC_OCEAN
+        {{0x0100000000000002ULL, 0x0000000000000000ULL}},    // BARCELONA
+        {{0x0000800000000000ULL, 0x0000000000000000ULL}},    // BARI
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // BAY_OF_BISCAY
+        {{0x4400000000000000ULL, 0x0000000000000000ULL}},    // BELGRADE
+        {{0x0010001080000000ULL, 0x0000000000000000ULL}},    // BERLIN
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // BLACK_SEA
+        {{0x0104000000000000ULL, 0x0000000000000000ULL}},    // BORDEAUX
+        {{0x0004000000080000ULL, 0x0000000000000000ULL}},    // BRUSSELS
+        {{0x4000000004100000ULL, 0x0000000000000000ULL}},    // BUCHAREST
+        {{0x4000000000000000ULL, 0x0000000000000010ULL}},    // BUDAPEST
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // CADIZ
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // CAGLIARI
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // CASTLE_DRACULA
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // CLERMONT_FERRAND
+        {{0x0000000002001000ULL, 0x0000000000000000ULL}},    // COLOGNE
+        {{0x0000000000002000ULL, 0x0000000000000000ULL}},    // CONSTANTA
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // DUBLIN
+        {{0x0000020000000000ULL, 0x0000000000000000ULL}},    // EDINBURGH
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // ENGLISH_CHANNEL
+        {{0x0020100000000000ULL, 0x0000000000000000ULL}},    // FLORENCE
+        {{0x1000001000080000ULL, 0x0000000000000000ULL}},    // FRANKFURT
+        {{0x0000000000002000ULL, 0x0000000000000000ULL}},    // GALATZ
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // GALWAY
+        {{0x0000100000000000ULL, 0x0000000000000000ULL}},    // GENEVA
+        {{0x0000100000000000ULL, 0x0000000000000000ULL}},    // GENOA
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // GRANADA
+        {{0x0000000000000200ULL, 0x0000000000000000ULL}},    // HAMBURG
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // IONIAN_SEA
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // IRISH_SEA
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // KLAUSENBURG
+        {{0x0004000000000000ULL, 0x0000000000000000ULL}},    // LE_HAVRE
+        {{0x0002000002000200ULL, 0x0000000000000000ULL}},    // LEIPZIG
+        {{0x0000010000000000ULL, 0x0000000000000000ULL}},    // LISBON
+        {{0x0000020000000000ULL, 0x0000000000000000ULL}},    // LIVERPOOL
+        {{0x2000020000000000ULL, 0x0000000000000000ULL}},    // LONDON
+        {{0x0180002000000002ULL, 0x0000000000000000ULL}},    // MADRID
+        {{0x000000c000400000ULL, 0x0000000000000000ULL}},    // MANCHESTER
+        {{0x0004000000000000ULL, 0x0000000000000000ULL}},    // MARSEILLES
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // MEDITERRANEAN_SEA
+        {{0x0000000031000000ULL, 0x0000000000000040ULL}},    // MILAN
+        {{0x0002000000000000ULL, 0x0000000000000000ULL}},    // MUNICH
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // NANTES
+        {{0x0020000000000040ULL, 0x0000000000000000ULL}},    // NAPLES
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // NORTH_SEA
+        {{0x0000201000000000ULL, 0x0000000000000000ULL}},    // NUREMBURG
+        {{0x0000040800001800ULL, 0x0000000000000000ULL}},    // PARIS
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // PLYMOUTH
+        {{0x0000000000000200ULL, 0x0000000000000010ULL}},    // PRAGUE
+        {{0x0000800001000000ULL, 0x0000000000000000ULL}},    // ROME
+        {{0x0400000000000000ULL, 0x0000000000000000ULL}},    // SALONICA
+        {{0x0000010000000000ULL, 0x0000000000000000ULL}},    // SANTANDER
+        {{0x0000010000000820ULL, 0x0000000000000000ULL}},    // SARAGOSSA
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // SARAJEVO
+        {{0x0040000000000100ULL, 0x0000000000000004ULL}},    // SOFIA
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // ST_JOSEPH_AND_ST_MARYS
+        {{0x0000000002000000ULL, 0x0000000000000040ULL}},    // STRASBOURG
+        {{0x0000008000000000ULL, 0x0000000000000000ULL}},    // SWANSEA
+        {{0x0000000000006100ULL, 0x0000000000000000ULL}},    // SZEGED
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // TOULOUSE
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // TYRRHENIAN_SEA
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // VALONA
+        {{0x0400000000000000ULL, 0x0000000000000000ULL}},    // VARNA
+        {{0x0000000000000000ULL, 0x0000000000000010ULL}},    // VENICE
+        {{0x0010000000004000ULL, 0x0000000000000008ULL}},    // VIENNA
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // ZAGREB
+        {{0x1000100000000000ULL, 0x0000000000000000ULL}},    // ZURICH
+    },
+    [BOAT] = {
+        {{0x0000000100000040ULL, 0x0000000000000008ULL}},    // ADRIATIC_SEA
+        {{0x0000080000000000ULL, 0x0000000000000000ULL}},    // ALICANTE
+        {{0x0001000000000000ULL, 0x0000000000000000ULL}},    // AMSTERDAM
+        {{0x0000000100000000ULL, 0x0000000000000000ULL}},    // ATHENS
+        {{0x0001082208808080ULL, 0x0000000000000000ULL}},    // ATLANTIC_OCEAN
+        {{0x0000080000000000ULL, 0x0000000000000000ULL}},    // BARCELONA
+        {{0x0000000000000001ULL, 0x0000000000000000ULL}},    // BARI
+        {{0x0080400000000810ULL, 0x0000000000000000ULL}},    // BAY_OF_BISCAY
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // BELGRADE
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // BERLIN
+        {{0x0000000100100000ULL, 0x0000000000000004ULL}},    // BLACK_SEA
+        {{0x0000000000000080ULL, 0x0000000000000000ULL}},    // BORDEAUX
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // BRUSSELS
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // BUCHAREST
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // BUDAPEST
+        {{0x0000000000000010ULL, 0x0000000000000000ULL}},    // CADIZ
+        {{0x0000080000000000ULL, 0x0000000000000001ULL}},    // CAGLIARI
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // CASTLE_DRACULA
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // CLERMONT_FERRAND
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // COLOGNE
+        {{0x0000000000000400ULL, 0x0000000000000000ULL}},    // CONSTANTA
+        {{0x0000000200000000ULL, 0x0000000000000000ULL}},    // DUBLIN
+        {{0x0001000000000000ULL, 0x0000000000000000ULL}},    // EDINBURGH
+        {{0x0009008800000010ULL, 0x0000000000000000ULL}},    // ENGLISH_CHANNEL
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // FLORENCE
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // FRANKFURT
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // GALATZ
+        {{0x0000000000000010ULL, 0x0000000000000000ULL}},    // GALWAY
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // GENEVA
+        {{0x0000000000000000ULL, 0x0000000000000001ULL}},    // GENOA
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // GRANADA
+        {{0x0001000000000000ULL, 0x0000000000000000ULL}},    // HAMBURG
+        {{0x0040000000000409ULL, 0x0000000000000003ULL}},    // IONIAN_SEA
+        {{0x2000004000200010ULL, 0x0000000000000000ULL}},    // IRISH_SEA
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // KLAUSENBURG
+        {{0x0000000000800000ULL, 0x0000000000000000ULL}},    // LE_HAVRE
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // LEIPZIG
+        {{0x0000000000000010ULL, 0x0000000000000000ULL}},    // LISBON
+        {{0x0000000200000000ULL, 0x0000000000000000ULL}},    // LIVERPOOL
+        {{0x0000000000800000ULL, 0x0000000000000000ULL}},    // LONDON
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // MADRID
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // MANCHESTER
+        {{0x0000080000000000ULL, 0x0000000000000000ULL}},    // MARSEILLES
+        {{0x0000040000010032ULL, 0x0000000000000001ULL}},    // MEDITERRANEAN_SEA
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // MILAN
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // MUNICH
+        {{0x0000000000000080ULL, 0x0000000000000000ULL}},    // NANTES
+        {{0x0000000000000000ULL, 0x0000000000000001ULL}},    // NAPLES
+        {{0x0000000080c00014ULL, 0x0000000000000000ULL}},    // NORTH_SEA
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // NUREMBURG
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // PARIS
+        {{0x0000000000800000ULL, 0x0000000000000000ULL}},    // PLYMOUTH
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // PRAGUE
+        {{0x0000000000000000ULL, 0x0000000000000001ULL}},    // ROME
+        {{0x0000000100000000ULL, 0x0000000000000000ULL}},    // SALONICA
+        {{0x0000000000000080ULL, 0x0000000000000000ULL}},    // SANTANDER
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // SARAGOSSA
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // SARAJEVO
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // SOFIA
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // ST_JOSEPH_AND_ST_MARYS
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // STRASBOURG
+        {{0x0000000200000000ULL, 0x0000000000000000ULL}},    // SWANSEA
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // SZEGED
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // TOULOUSE
+        {{0x0020880120010000ULL, 0x0000000000000000ULL}},    // TYRRHENIAN_SEA
+        {{0x0000000100000000ULL, 0x0000000000000000ULL}},    // VALONA
+        {{0x0000000000000400ULL, 0x0000000000000000ULL}},    // VARNA
+        {{0x0000000000000001ULL, 0x0000000000000000ULL}},    // VENICE
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // VIENNA
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // ZAGREB
+        {{0x0000000000000000ULL, 0x0000000000000000ULL}},    // ZURICH
+    },
+};
+
+#endif
+
+#endif
@@ -110,34 +110,60 @@ int idToType(LocationID p)
    return places[p].type;
 }
 
+// lookup tables built from places[] the first time one is needed
+// entries are a place number plus one, so zero means there is no such place
+#define LETTERS     26
+#define NAME_SLOTS  128     // a power of two, comfortably more than the places
+
+static signed char abbrevTable[LETTERS][LETTERS];
+static signed char nameTable[NAME_SLOTS];
+static int tablesBuilt = 0;
+
+static unsigned nameHash(char *name)
+{
+   unsigned h = 0;
+   while (*name != '\0') h = h * 31 + (unsigned char)*name++;
+   return h & (NAME_SLOTS - 1);
+}
+
+static void buildTables(void)
+{
+   LocationID p;
+   unsigned h;
+   for (p = MIN_MAP_LOCATION; p <= MAX_MAP_LOCATION; p++) {
+      char *c = places[p].abbrev;
+      abbrevTable[c[0] - 'A'][c[1] - 'A'] = p + 1;
+      for (h = nameHash(places[p].name); nameTable[h] != 0; h = (h + 1) & (NAME_SLOTS - 1))
+         ;
+      nameTable[h] = p + 1;
+   }
+   tablesBuilt = 1;
+}
+
+// build the lookup tables now rather than the first time they are used
+void buildPlaceTables(void)
+{
+   if (!tablesBuilt) buildTables();
+}
+
 // given a Place name, return its ID number
-// binary search
+// hash table probe
 int nameToID(char *name)
 {
-   int lo = MIN_MAP_LOCATION, hi = MAX_MAP_LOCATION;
-   while (lo <= hi) {
-      int mid = (hi+lo)/2;
-      int ord = strcmp(name,places[mid].name);
-      if (ord < 0)
-         hi = mid-1;
-      else if (ord > 0)
-         lo = mid+1;
-      else
-         return places[mid].id;
+   unsigned h;
+   if (!tablesBuilt) buildTables();
+   for (h = nameHash(name); nameTable[h] != 0; h = (h + 1) & (NAME_SLOTS - 1)) {
+      if (strcmp(name, places[nameTable[h] - 1].name) == 0) return nameTable[h] - 1;
    }
    return NOWHERE;
 }
 
 // given a Place abbreviation (2 char), return its ID number
+// direct index on the two letters
 int abbrevToID(char *abbrev)
 {
-   // an attempt to optimise a linear search
-   Place *p;
-   Place *first = &places[MIN_MAP_LOCATION];
-   Place *last = &places[MAX_MAP_LOCATION];
-   for (p = first; p <= last; p++) {
-      char *c = p->abbrev;
-      if (c[0] == abbrev[0] && c[1] == abbrev[1] && c[2] == '\0') return p->id;
-   }
-   return NOWHERE;
+   unsigned a = abbrev[0] - 'A', b = abbrev[1] - 'A';
+   if (a >= LETTERS || b >= LETTERS) return NOWHERE;
+   if (!tablesBuilt) buildTables();
+   return abbrevTable[a][b] - 1;
 }
@@ -136,6 +136,10 @@ int nameToID(char *name);
 // given a Place abbreviation, return its ID number
 int abbrevToID(char *abbrev);
 
+// build the tables nameToID() and abbrevToID() look places up in now,
+//  rather than the first time they are used
+void buildPlaceTables(void);
+
 #define isLand(place)  (idToType(place) == LAND)
 #define isSea(place)  (idToType(place) == SEA)
 
@@ -0,0 +1,211 @@
+// RandomGame.c ... made up games of random legal moves (see RandomGame.h)
+
+#include <stdlib.h>
+#include <string.h>
+#include "Game.h"
+#include "Globals.h"
+#include "Places.h"
+#include "GameView.h"
+#include "GameState.h"
+#include "LocSet.h"
+#include "RandomGame.h"
+
+#define LOW_BLOOD          12     // Dracula avoids the sea at or below this
+
+static int randomFrom(LocSet s) {
+    LocationID p, chosen = NOWHERE;
+    int seen = 0;
+    while ((p = popFromSet(&s)) != NOWHERE) {
+        if (rand() % ++seen == 0) chosen = p;
+    }
+    return chosen;
+}
+
+// every move Dracula may make: places not in the trail he is leaving,
+//  a hide (not at sea) and double backs, each while none is in the trail
+static int dracMoves(GameState *state, LocationID moves[NUM_MAP_LOCATIONS + TRAIL_SIZE]) {
+    LocationID from = state->trail[0];
+    LocSet adjacent = movesFromSet(from, PLAYER_DRACULA, state->round, TRUE, FALSE, TRUE);
+    LocSet places = adjacent;
+    int hidden = FALSE, doubledBack = FALSE, n = 0, i;
+    LocationID p;
+
+    for (i = 0; i < TRAIL_SIZE - 1; i++) {
+        if (validPlace(state->trail[i])) removeFromSet(&places, state->trail[i]);
+        if (state->moves[i] == HIDE) hidden = TRUE;
+        if (state->moves[i] >= DOUBLE_BACK_1 && state->moves[i] <= DOUBLE_BACK_5) doubledBack = TRUE;
+    }
+    while ((p = popFromSet(&places)) != NOWHERE) moves[n++] = p;
+    if (!hidden && !isSea(from)) moves[n++] = HIDE;
+    for (i = 0; i < TRAIL_SIZE - 1 && !doubledBack; i++) {
+        if (validPlace(state->trail[i]) && inSet(adjacent, state->trail[i])) {
+            moves[n++] = DOUBLE_BACK_1 + i;
+        }
+    }
+    return n;
+}
+
+// where a move by Dracula takes him
+static LocationID dracDestination(GameState *state, LocationID move) {
+    if (move == HIDE) return state->trail[0];
+    if (move >= DOUBLE_BACK_1 && move <= DOUBLE_BACK_5) return state->trail[move - DOUBLE_BACK_1];
+    if (move == TELEPORT) return CASTLE_DRACULA;
+    return move;
+}
+
+static void moveToAbbrev(LocationID move, char abbrev[2]) {
+    char place[3];
+    if (move == HIDE) {
+        memcpy(abbrev, "HI", 2);
+    } else if (move == TELEPORT) {
+        memcpy(abbrev, "TP", 2);
+    } else if (move >= DOUBLE_BACK_1 && move <= DOUBLE_BACK_5) {
+        abbrev[0] = 'D';
+        abbrev[1] = '1' + move - DOUBLE_BACK_1;
+    } else {
+        idToAbbrev(move, place);
+        memcpy(abbrev, place, 2);
+    }
+}
+
+static int onHunter(GameState *state, LocationID place) {
+    PlayerID hunter;
+    for (hunter = PLAYER_LORD_GODALMING; hunter < PLAYER_DRACULA; hunter++) {
+        if (state->location[hunter] == place) return TRUE;
+    }
+    return FALSE;
+}
+
+// a random move for Dracula, one that keeps him out of trouble if he can
+//  unless this is one of the wild ones
+static LocationID chooseDracMove(GameState *state, int wild) {
+    LocationID moves[NUM_MAP_LOCATIONS + TRAIL_SIZE], safe[NUM_MAP_LOCATIONS + TRAIL_SIZE];
+    LocationID to;
+    int n, nSafe = 0, i;
+
+    if (state->trail[0] == NOWHERE) {
+        do {
+            to = rand() % NUM_MAP_LOCATIONS;
+        } while (to == ST_JOSEPH_AND_ST_MARYS || isSea(to) || onHunter(state, to));
+        return to;
+    }
+    n = dracMoves(state, moves);
+    if (n == 0) return TELEPORT;
+    if (wild > 0 && rand() % 100 < wild) return moves[rand() % n];
+    for (i = 0; i < n; i++) {
+        to = dracDestination(state, moves[i]);
+        if (onHunter(state, to)) continue;
+        if (isSea(to) && state->health[PLAYER_DRACULA] <= LOW_BLOOD) continue;
+        safe[nSafe++] = moves[i];
+    }
+    if (nSafe > 0) return safe[rand() % nSafe];
+    return moves[rand() % n];
+}
+
+// a random move for a hunter, not onto Dracula if it can be helped
+//  unless this is one of the wild ones
+static LocationID chooseHunterMove(GameState *state, int wild) {
+    PlayerID hunter = state->player;
+    LocationID from = state->location[hunter];
+    LocSet moves;
+
+    if (from == NOWHERE) return rand() % NUM_MAP_LOCATIONS;
+    moves = movesFromSet(from, hunter, state->round, TRUE, TRUE, TRUE);
+    if (wild > 0 && rand() % 100 < wild) return randomFrom(moves);
+    if (validPlace(state->location[PLAYER_DRACULA]) && setSize(moves) > 1) {
+        removeFromSet(&moves, state->location[PLAYER_DRACULA]);
+    }
+    return randomFrom(moves);
+}
+
+static void addPlay(RandomGame *g, char play[PLAY_SIZE]) {
+    int at = g->turns * PLAY_SIZE;
+    if (g->turns > 0) {
+        g->plays[at - 1] = ' ';
+        g->hunterPlays[at - 1] = ' ';
+    }
+    memcpy(&g->plays[at], play, PLAY_SIZE);
+    memcpy(&g->hunterPlays[at], play, PLAY_SIZE);
+    g->turns++;
+}
+
+static void playDracula(RandomGame *g, GameState *state, LocationID move) {
+    char play[PLAY_SIZE] = "D......";
+    unsigned char leaving = state->minions[TRAIL_SIZE - 1];
+    MoveUndo undo;
+    int turn = g->turns, i;
+
+    moveToAbbrev(move, &play[1]);
+    applyMove(state, move, &undo);
+    if (state->minions[0] & TRAP_HERE) play[3] = 'T';
+    if (state->minions[0] & VAMPIRE_HERE) play[4] = 'V';
+    if (leaving & VAMPIRE_HERE) play[5] = 'V';
+    else if (leaving & TRAP_HERE) play[5] = 'M';
+    addPlay(g, play);
+
+    for (i = TRAIL_SIZE - 1; i > 0; i--) g->dracTurn[i] = g->dracTurn[i - 1];
+    g->dracTurn[0] = turn;
+    if (validPlace(move) && move != CASTLE_DRACULA && !onHunter(state, move)) {
+        memcpy(&g->hunterPlays[turn * PLAY_SIZE + 1], isSea(move) ? "S?" : "C?", 2);
+    }
+}
+
+static void playHunter(RandomGame *g, GameState *state, LocationID move) {
+    char play[PLAY_SIZE] = "G......";
+    MoveUndo undo;
+    int n = 3, i, turn;
+
+    play[0] = "GSHM"[(int)state->player];
+    moveToAbbrev(move, &play[1]);
+    for (i = 0; i < TRAIL_SIZE && n < PLAY_SIZE - 1; i++) {
+        if (state->trail[i] == move && (state->minions[i] & TRAP_HERE)) play[n++] = 'T';
+    }
+    for (i = 0; i < TRAIL_SIZE && n < PLAY_SIZE - 1; i++) {
+        if (state->trail[i] == move && (state->minions[i] & VAMPIRE_HERE)) play[n++] = 'V';
+    }
+    if (n < PLAY_SIZE - 1 && move == state->location[PLAYER_DRACULA] && !isSea(move)) {
+        play[n++] = 'D';
+    }
+    applyMove(state, move, &undo);
+    addPlay(g, play);
+
+    // a hunter going through a place in the trail shows that it was there
+    for (i = 0; i < TRAIL_SIZE; i++) {
+        turn = g->dracTurn[i];
+        if (state->trail[i] == move && turn >= 0) {
+            memcpy(&g->hunterPlays[turn * PLAY_SIZE + 1], &g->plays[turn * PLAY_SIZE + 1], 2);
+        }
+    }
+}
+
+
+void startRandomGame(RandomGame *g, int seed, int wild) {
+    PlayerMessage none[1];
+    GameView start = newGameView("", none);
+    int i;
+
+    srand(seed);
+    memset(g, 0, sizeof(RandomGame));
+    for (i = 0; i < TRAIL_SIZE; i++) g->dracTurn[i] = -1;
+    g->wild = wild;
+    viewToState(start, &g->state);
+    disposeGameView(start);
+}
+
+int playRandomTurn(RandomGame *g) {
+    GameState *state = &g->state;
+
+    if (g->turns >= MAX_TURNS) return FALSE;
+    if (g->turns > 0 && (state->health[PLAYER_DRACULA] <= 0 || state->score <= 0)) return FALSE;
+    if (state->player == PLAYER_DRACULA) {
+        playDracula(g, state, chooseDracMove(state, g->wild));
+    } else {
+        playHunter(g, state, chooseHunterMove(state, g->wild));
+    }
+    return TRUE;
+}
+
+void makeRandomGame(RandomGame *g, int seed, int wild) {
+    startRandomGame(g, seed, wild);
+    while (playRandomTurn(g)) ;
+}
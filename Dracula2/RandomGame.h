@@ -0,0 +1,44 @@
+// RandomGame.h ... made up games of random legal moves, for testing
+//
+// Games are made up by playing random legal moves on a GameState, and
+// written out the way the real game would: in full for Dracula, and with
+// his moves hidden (C?, S?) from the hunters unless they would see them.
+// Dracula keeps clear of the hunters, and of the sea when he is low on
+// blood, and the hunters keep clear of him, so the games usually last
+// until the vampires and the clock have used up the score. Some of the
+// moves can be made with no care at all instead (wild), which gives
+// shorter games with more encounters, deaths and teleports in them.
+//
+// The moves come from rand(), so a game depends only on its seed and
+// wild, as long as nothing else calls rand() while it is being played.
+
+#ifndef RANDOMGAME_H
+#define RANDOMGAME_H
+
+#include "Globals.h"
+#include "Game.h"
+#include "GameState.h"
+
+#define PLAY_SIZE          8      // "GLO.... " including the space
+#define MAX_TURNS          ((GAME_START_SCORE + 1) * NUM_PLAYERS)
+#define MAX_PLAYS_SIZE     (MAX_TURNS * PLAY_SIZE + 1)
+
+typedef struct randomGame {
+    char plays[MAX_PLAYS_SIZE];           // everything, as Dracula sees it
+    char hunterPlays[MAX_PLAYS_SIZE];     // Dracula's moves hidden where need be
+    int turns;
+    int dracTurn[TRAIL_SIZE];             // the turns that made up the trail
+    int wild;                             // percent of moves made with no care
+    GameState state;                      // the game after the plays so far
+} RandomGame;
+
+// a game with no plays yet, seeding rand() with seed
+void startRandomGame(RandomGame *g, int seed, int wild);
+
+// play the next turn, or return FALSE if the game is already over
+int playRandomTurn(RandomGame *g);
+
+// a whole game
+void makeRandomGame(RandomGame *g, int seed, int wild);
+
+#endif
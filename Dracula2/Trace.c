@@ -0,0 +1,164 @@
+// Trace.c ... tracing of the AIs' hot helper functions (see Trace.h)
+
+#ifdef TRACE
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdatomic.h>
+#include <time.h>
+#include <unistd.h>
+#include "Trace.h"
+
+#define MAX_EVENTS     (1 << 17)    // calls kept for the trace file, the rest are only counted
+#define DEFAULT_FILE   "trace.json"
+
+static const char *names[NUM_TRACED] = {
+    "decideMove", "newGameView", "connectedLocations", "fillConnectedLocations",
+    "findPathLength", "hunterPathLength", "isReachable", "dracPathLength",
+    "hunterRoute"
+};
+
+// one finished call, for the trace file
+typedef struct traceEvent {
+    int function;
+    int thread;
+    long long start;
+    long long duration;
+} TraceEvent;
+
+// totals for the move so far, added to by every thread
+static atomic_long calls[NUM_TRACED];
+static atomic_llong nanos[NUM_TRACED];
+static atomic_long mallocs[NUM_TRACED];
+static atomic_long frees[NUM_TRACED];
+
+static TraceEvent events[MAX_EVENTS];
+static atomic_int numEvents;
+static atomic_int numThreads;
+static atomic_llong traceStart;
+
+// what this thread has allocated and freed, counted by the wrappers below
+static __thread long threadMallocs, threadFrees;
+static __thread int threadID = -1;
+
+static long long now(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1000000000LL + t.tv_nsec;
+}
+
+TraceSpan traceBegin(int function)
+{
+    TraceSpan span;
+    long long none = 0;
+
+    span.function = function;
+    span.start = now();
+    span.mallocs = threadMallocs;
+    span.frees = threadFrees;
+    atomic_compare_exchange_strong(&traceStart, &none, span.start);
+    if (threadID < 0) threadID = atomic_fetch_add(&numThreads, 1);
+    return span;
+}
+
+// every call so far as a Chrome trace ("X" events, times in microseconds)
+static void writeTraceFile(void)
+{
+    char *name = getenv("TRACE_FILE");
+    int n = numEvents, i;
+    FILE *out;
+
+    if (n > MAX_EVENTS) n = MAX_EVENTS;
+    out = fopen(name != NULL ? name : DEFAULT_FILE, "w");
+    if (out == NULL) {
+        perror("trace file");
+        return;
+    }
+    fprintf(out, "{\"traceEvents\":[\n");
+    for (i = 0; i < n; i++) {
+        fprintf(out, "{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,"
+                "\"pid\":%d,\"tid\":%d}%s\n",
+                names[events[i].function], (events[i].start - traceStart) / 1000.0,
+                events[i].duration / 1000.0, (int)getpid(), events[i].thread,
+                (i < n - 1) ? "," : "");
+    }
+    fprintf(out, "],\"displayTimeUnit\":\"ms\"}\n");
+    fclose(out);
+}
+
+// print what the move spent its time on and start counting afresh
+static void reportMove(long long duration)
+{
+    int f;
+
+    fprintf(stderr, "trace: move took %.3f ms\n", duration / 1e6);
+    fprintf(stderr, "  %-24s %9s %12s %10s %9s %9s\n",
+            "function", "calls", "total ms", "mean us", "mallocs", "frees");
+    for (f = 0; f < NUM_TRACED; f++) {
+        if (calls[f] == 0) continue;
+        fprintf(stderr, "  %-24s %9ld %12.3f %10.3f %9ld %9ld\n",
+                names[f], (long)calls[f], nanos[f] / 1e6, nanos[f] / 1e3 / calls[f],
+                (long)mallocs[f], (long)frees[f]);
+        calls[f] = 0;
+        nanos[f] = 0;
+        mallocs[f] = 0;
+        frees[f] = 0;
+    }
+    if (numEvents > MAX_EVENTS) {
+        fprintf(stderr, "  (only the first %d calls are in the trace file)\n", MAX_EVENTS);
+    }
+    writeTraceFile();
+}
+
+void traceEnd(TraceSpan *span)
+{
+    long long duration = now() - span->start;
+    int f = span->function, i;
+
+    atomic_fetch_add(&calls[f], 1);
+    atomic_fetch_add(&nanos[f], duration);
+    atomic_fetch_add(&mallocs[f], threadMallocs - span->mallocs);
+    atomic_fetch_add(&frees[f], threadFrees - span->frees);
+    i = atomic_fetch_add(&numEvents, 1);
+    if (i < MAX_EVENTS) {
+        events[i].function = f;
+        events[i].thread = threadID;
+        events[i].start = span->start;
+        events[i].duration = duration;
+    }
+    if (f == TRACE_DECIDE_MOVE) reportMove(duration);
+}
+
+// the AIs are linked with --wrap for these when tracing (see the Makefile)
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t n, size_t size);
+void *__real_realloc(void *p, size_t size);
+void __real_free(void *p);
+
+void *__wrap_malloc(size_t size)
+{
+    threadMallocs++;
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t n, size_t size)
+{
+    threadMallocs++;
+    return __real_calloc(n, size);
+}
+
+void *__wrap_realloc(void *p, size_t size)
+{
+    if (p == NULL) threadMallocs++;
+    else if (size == 0) threadFrees++;
+    return __real_realloc(p, size);
+}
+
+void __wrap_free(void *p)
+{
+    if (p != NULL) threadFrees++;
+    __real_free(p);
+}
+
+#endif
@@ -0,0 +1,54 @@
+// Trace.h ... optional timing of the AIs' hot helper functions
+//
+// Built with -DTRACE (make TRACE=1), a function that starts with
+//     TRACE_SCOPE(TRACE_FIND_PATH_LENGTH);
+// has its calls counted and timed, along with the mallocs and frees
+// made while it runs (callees included). decideDraculaMove() and
+// decideHunterMove() are traced with TRACE_MOVE(), and when a move is
+// finished a summary of it goes to stderr and every traced call so far
+// is written to a Chrome trace file (TRACE_FILE in the environment, or
+// trace.json) that chrome://tracing or Perfetto can open.
+//
+// Without -DTRACE the macros are empty and nothing is recorded.
+
+#ifndef TRACE_H
+#define TRACE_H
+
+// the functions that can be traced
+#define TRACE_DECIDE_MOVE              0
+#define TRACE_NEW_GAME_VIEW            1
+#define TRACE_CONNECTED_LOCATIONS      2
+#define TRACE_FILL_CONNECTED           3
+#define TRACE_FIND_PATH_LENGTH         4
+#define TRACE_HUNTER_PATH_LENGTH       5
+#define TRACE_IS_REACHABLE             6
+#define TRACE_DRAC_PATH_LENGTH         7
+#define TRACE_HUNTER_ROUTE             8
+#define NUM_TRACED                     9
+
+#ifdef TRACE
+
+// one call in progress
+typedef struct traceSpan {
+    int function;
+    long long start;               // nanoseconds
+    long mallocs;                  // this thread's counts when it started
+    long frees;
+} TraceSpan;
+
+TraceSpan traceBegin(int function);
+void traceEnd(TraceSpan *span);
+
+// the span ends (and is recorded) wherever the function returns
+#define TRACE_SCOPE(function) \
+    TraceSpan traceSpan __attribute__((cleanup(traceEnd))) = traceBegin(function)
+#define TRACE_MOVE()  TRACE_SCOPE(TRACE_DECIDE_MOVE)
+
+#else
+
+#define TRACE_SCOPE(function)
+#define TRACE_MOVE()
+
+#endif
+
+#endif
@@ -0,0 +1,198 @@
+// TransTable.c ... Zobrist keys and transposition table implementation
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include "TransTable.h"
+
+#define NUM_CODES        (NUM_MAP_LOCATIONS + TELEPORT - CITY_UNKNOWN + 2)
+#define NUM_HEALTH_KEYS  100    // health at or above this all hashes the same
+#define NUM_ROUND_KEYS   52     // rail phases repeat every 4, vampires every 13
+#define TRAIL_ROTATION   7      // bits a trail entry's key turns per slot
+#define BUCKET_SIZE      4
+
+// the keys, made the first time one is needed
+static HashKey locKeys[NUM_PLAYERS][NUM_CODES];
+static HashKey healthKeys[NUM_PLAYERS][NUM_HEALTH_KEYS];
+static HashKey roundKeys[NUM_ROUND_KEYS];
+static HashKey trailLocKeys[NUM_CODES];
+static HashKey trailMoveKeys[NUM_CODES];
+static int keysMade = 0;
+
+// one position in the table, the key is zero for an empty entry
+typedef struct ttEntry {
+    HashKey key;
+    float   value;
+    short   depth;
+    short   unused;
+} TTEntry;
+
+// the entries that a key can go in, one cache line's worth
+typedef struct ttBucket {
+    TTEntry entry[BUCKET_SIZE];
+} __attribute__((aligned(64))) TTBucket;
+
+struct transTable {
+    TTBucket *buckets;
+    HashKey mask;            // number of buckets - 1
+};
+
+// splitmix64, so the keys are the same every run
+static HashKey nextKey(HashKey *state)
+{
+    HashKey z = (*state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+static void makeKeys(void)
+{
+    HashKey state = 0x44524143554C41ULL;
+    int i, j;
+    for (i = 0; i < NUM_PLAYERS; i++) {
+        for (j = 0; j < NUM_CODES; j++) locKeys[i][j] = nextKey(&state);
+        for (j = 0; j < NUM_HEALTH_KEYS; j++) healthKeys[i][j] = nextKey(&state);
+    }
+    for (j = 0; j < NUM_ROUND_KEYS; j++) roundKeys[j] = nextKey(&state);
+    for (j = 0; j < NUM_CODES; j++) {
+        trailLocKeys[j] = nextKey(&state);
+        trailMoveKeys[j] = nextKey(&state);
+    }
+    keysMade = 1;
+}
+
+// index into the key arrays for any LocationID
+//  (places, then the other locations, then unknown)
+static int codeOf(LocationID where)
+{
+    if (validPlace(where)) return where;
+    if (where >= CITY_UNKNOWN && where <= TELEPORT) {
+        return NUM_MAP_LOCATIONS + where - CITY_UNKNOWN;
+    }
+    return NUM_CODES - 1;
+}
+
+static HashKey rotate(HashKey key, int bits)
+{
+    bits %= 64;
+    if (bits == 0) return key;
+    return (key << bits) | (key >> (64 - bits));
+}
+
+// key for one trail entry, before it is turned for its slot
+static HashKey entryKey(LocationID loc, LocationID move)
+{
+    return trailLocKeys[codeOf(loc)] ^ trailMoveKeys[codeOf(move)];
+}
+
+HashKey playerKey(PlayerID player, LocationID where)
+{
+    assert(player >= PLAYER_LORD_GODALMING && player < NUM_PLAYERS);
+    if (!keysMade) makeKeys();
+    return locKeys[player][codeOf(where)];
+}
+
+HashKey healthKey(PlayerID player, int health)
+{
+    assert(player >= PLAYER_LORD_GODALMING && player < NUM_PLAYERS);
+    if (!keysMade) makeKeys();
+    if (health < 0) health = 0;
+    if (health >= NUM_HEALTH_KEYS) health = NUM_HEALTH_KEYS - 1;
+    return healthKeys[player][health];
+}
+
+HashKey roundKey(Round round)
+{
+    assert(round >= 0);
+    if (!keysMade) makeKeys();
+    return roundKeys[round % NUM_ROUND_KEYS];
+}
+
+// the entry in slot i has its key turned i * TRAIL_ROTATION bits, so
+//  moving every entry down one slot is a single turn of the whole key
+HashKey trailKey(LocationID trail[TRAIL_SIZE], LocationID hideTrail[TRAIL_SIZE])
+{
+    HashKey key = 0;
+    int i;
+    if (!keysMade) makeKeys();
+    for (i = 0; i < TRAIL_SIZE; i++) {
+        key ^= rotate(entryKey(trail[i], hideTrail[i]), i * TRAIL_ROTATION);
+    }
+    return key;
+}
+
+HashKey pushTrailKey(HashKey key, LocationID oldLoc, LocationID oldMove,
+                     LocationID newLoc, LocationID newMove)
+{
+    if (!keysMade) makeKeys();
+    key ^= rotate(entryKey(oldLoc, oldMove), (TRAIL_SIZE - 1) * TRAIL_ROTATION);
+    return rotate(key, TRAIL_ROTATION) ^ entryKey(newLoc, newMove);
+}
+
+TransTable newTransTable(int sizeLog2)
+{
+    TransTable t;
+    size_t numBuckets;
+    assert(sizeLog2 >= 0 && sizeLog2 < 31);
+    numBuckets = (size_t)1 << sizeLog2;
+    t = malloc(sizeof(struct transTable));
+    assert(t != NULL);
+    t->buckets = aligned_alloc(sizeof(TTBucket), numBuckets * sizeof(TTBucket));
+    assert(t->buckets != NULL);
+    t->mask = numBuckets - 1;
+    clearTransTable(t);
+    return t;
+}
+
+void disposeTransTable(TransTable t)
+{
+    assert(t != NULL);
+    free(t->buckets);
+    free(t);
+}
+
+void clearTransTable(TransTable t)
+{
+    assert(t != NULL);
+    memset(t->buckets, 0, (t->mask + 1) * sizeof(TTBucket));
+}
+
+int probeTransTable(TransTable t, HashKey key, int depth, double *value)
+{
+    TTBucket *b = &t->buckets[key & t->mask];
+    int i;
+    for (i = 0; i < BUCKET_SIZE; i++) {
+        if (b->entry[i].key == key) {
+            if (b->entry[i].depth < depth) return FALSE;
+            *value = b->entry[i].value;
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+// an entry already holding key is updated, otherwise the shallowest
+//  entry in the bucket (an empty one if there is one) is replaced
+void storeTransTable(TransTable t, HashKey key, int depth, double value)
+{
+    TTBucket *b = &t->buckets[key & t->mask];
+    TTEntry *victim = NULL;
+    int i;
+    for (i = 0; i < BUCKET_SIZE && victim == NULL; i++) {
+        if (b->entry[i].key == key) victim = &b->entry[i];
+    }
+    if (victim != NULL && victim->depth > depth) return;
+    for (i = 0; i < BUCKET_SIZE && victim == NULL; i++) {
+        if (b->entry[i].key == 0) victim = &b->entry[i];
+    }
+    if (victim == NULL) {
+        victim = &b->entry[0];
+        for (i = 1; i < BUCKET_SIZE; i++) {
+            if (b->entry[i].depth < victim->depth) victim = &b->entry[i];
+        }
+    }
+    victim->key = key;
+    victim->value = value;
+    victim->depth = depth;
+}
@@ -0,0 +1,55 @@
+// TransTable.h ... Zobrist hashing and a transposition table for searches
+//
+// A position is hashed by XOR-ing together one random 64-bit key for each
+// thing in it (where each player is, Dracula's trail, health, the round),
+// so a simulated move only has to XOR out the keys that changed and XOR
+// in the new ones. The table remembers the value a search found for a
+// hashed position and how deep it looked, so positions reached again by
+// another order of moves don't need to be searched again.
+
+#ifndef TRANSTABLE_H
+#define TRANSTABLE_H
+
+#include "Globals.h"
+#include "Places.h"
+
+typedef unsigned long long HashKey;
+
+// key for player being at where (any LocationID, known or not)
+HashKey playerKey(PlayerID player, LocationID where);
+
+// key for player having the given health (blood or life points)
+HashKey healthKey(PlayerID player, int health);
+
+// key for the round, as far as the rules care about it
+//  (the rail phase and which rounds vampires mature in)
+HashKey roundKey(Round round);
+
+// key for Dracula's whole trail, from his real locations and the
+//  moves he made (hides and double backs) to get to them
+HashKey trailKey(LocationID trail[TRAIL_SIZE], LocationID hideTrail[TRAIL_SIZE]);
+
+// the trail key after Dracula makes a new move, given the old key,
+//  the entries that fall off the end of the trail and the new entries
+//  at the front (so the trail doesn't need hashing again from scratch)
+HashKey pushTrailKey(HashKey key, LocationID oldLoc, LocationID oldMove,
+                     LocationID newLoc, LocationID newMove);
+
+// transposition table ADT
+typedef struct transTable *TransTable;
+
+// make a table with 2^sizeLog2 buckets of four entries (64 bytes each)
+TransTable newTransTable(int sizeLog2);
+void disposeTransTable(TransTable t);
+
+// forget everything in the table
+void clearTransTable(TransTable t);
+
+// if the table has a value for key searched at least depth deep,
+//  store it in value and return TRUE, otherwise return FALSE
+int probeTransTable(TransTable t, HashKey key, int depth, double *value);
+
+// remember that searching key depth deep gave value
+void storeTransTable(TransTable t, HashKey key, int depth, double value);
+
+#endif
@@ -0,0 +1,436 @@
+// benchViews.c ... timing of the view functions on long synthetic games
+//
+// Games are made up by playing random legal moves (see RandomGame.h).
+// Every few turns a view is built from the plays so far and each of its
+// functions is called on it, and the time per call of each is reported.
+// The whole thing is done a few times and the quickest time kept, which
+// is steadier than the mean.
+//
+// Like player.c this is built twice: with -DI_AM_DRACULA it times
+// DracView, otherwise GameView and HunterView.
+//
+// usage: ./benchHunterView [-n games] [-s seed] [-r repeats]
+//                          [-c baseline file] [-x threshold]
+// Without -c one "name nanoseconds" line is printed for each function,
+// the format of the baseline file (benchBaseline.txt). With -c the times
+// are compared with the baseline, and the exit status is 1 if any call
+// got more than threshold times slower (see "make bench").
+//
+// So that a baseline made on one machine can be checked on another, each
+// run also times a fixed calibration loop (dependent loads from a table
+// the size of a view's data, and a little arithmetic), kept in the
+// baseline like a function. The baseline times are scaled by how much
+// quicker or slower the loop is now before they are compared.
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "Game.h"
+#include "Globals.h"
+#include "Places.h"
+#include "GameView.h"
+#include "GameState.h"
+#include "LocSet.h"
+#include "RandomGame.h"
+#ifdef I_AM_DRACULA
+#include "DracView.h"
+#else
+#include "HunterView.h"
+#endif
+
+#define TURN_STRIDE        7      // a view is timed every this many turns
+#define MIN_SLOWDOWN_NS    20.0   // smaller differences are just noise
+#define MAX_TIMED          32
+#define MAX_NAME           64
+#define CALIBRATION_SIZE   (1 << 16)  // entries in the calibration table
+#define CALIBRATION_STEPS  (1 << 20)  // loads in one calibration loop
+#ifdef I_AM_DRACULA
+#define CALIBRATION        "DracView.calibration"
+#else
+#define CALIBRATION        "HunterView.calibration"
+#endif
+
+// the time spent in one function
+typedef struct timed {
+    char name[MAX_NAME];
+    double ns;
+    long calls;
+    double best;                          // ns per call in the quickest run
+} Timed;
+
+static Timed timed[MAX_TIMED];
+static FILE *out;                         // where the results go (see main)
+static int numTimed;
+static PlayerMessage messages[MAX_TURNS];
+static unsigned int calibrationTable[CALIBRATION_SIZE];
+
+static double now(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+static Timed *timer(char *name) {
+    int i;
+    for (i = 0; i < numTimed; i++) {
+        if (strcmp(timed[i].name, name) == 0) return &timed[i];
+    }
+    if (numTimed == MAX_TIMED) {
+        fprintf(stderr, "too many timed functions\n");
+        exit(EXIT_FAILURE);
+    }
+    strcpy(timed[numTimed].name, name);
+    timed[numTimed].best = -1;
+    return &timed[numTimed++];
+}
+
+// time the code after n, which makes n calls of the function "name"
+#define TIME(name, n, ...) do {                      \
+        Timed *t_ = timer(name);                     \
+        double start_ = now();                       \
+        __VA_ARGS__;                                 \
+        t_->ns += now() - start_;                    \
+        t_->calls += (n);                            \
+    } while (0)
+
+
+//// Timing the views
+
+#ifdef I_AM_DRACULA
+
+// Dracula's view just before his turn
+static void timeView(char *plays) {
+    LocationID moves[NUM_MAP_LOCATIONS], trail[TRAIL_SIZE], hideTrail[TRAIL_SIZE];
+    LocationID work[TRAIL_SIZE], hideWork[TRAIL_SIZE], start, end, *list;
+    int numTraps, numVamps, n, sum = 0;
+    PlayerID p;
+    LocationID place;
+    GameState state;
+    DracView view;
+    Round round;
+
+    TIME("DracView.newDracView", 1, view = newDracView(plays, messages));
+    round = giveMeTheRound(view);
+    TIME("DracView.getters", 2 + 2 * NUM_PLAYERS,
+         sum += giveMeTheRound(view) + giveMeTheScore(view);
+         for (p = 0; p < NUM_PLAYERS; p++) sum += howHealthyIs(view, p) + whereIs(view, p));
+    TIME("DracView.lastMove", NUM_PLAYERS,
+         for (p = 0; p < NUM_PLAYERS; p++) lastMove(view, p, &start, &end));
+    TIME("DracView.whatsThere", NUM_MAP_LOCATIONS,
+         for (place = 0; place < NUM_MAP_LOCATIONS; place++) {
+             whatsThere(view, place, &numTraps, &numVamps);
+         });
+    TIME("DracView.giveMeTheTrail", 2 * NUM_PLAYERS,
+         for (p = 0; p < NUM_PLAYERS; p++) {
+             giveMeTheTrail(view, p, trail, FALSE);
+             giveMeTheTrail(view, p, hideTrail, TRUE);
+         });
+    TIME("DracView.encounters", NUM_MAP_LOCATIONS,
+         for (place = 0; place < NUM_MAP_LOCATIONS; place++) {
+             sum += trailPosition(view, place) + trailMove(view, place);
+         });
+    TIME("DracView.whereCanTheyGo", NUM_PLAYERS - 1,
+         for (p = 0; p < PLAYER_DRACULA; p++) {
+             list = whereCanTheyGo(view, &n, whereIs(view, p), p, round + 1, TRUE, TRUE, TRUE);
+             free(list);
+         });
+    TIME("DracView.fillWhereCanTheyGo", NUM_PLAYERS - 1,
+         for (p = 0; p < PLAYER_DRACULA; p++) {
+             fillWhereCanTheyGo(view, moves, whereIs(view, p), p, round + 1, TRUE, TRUE, TRUE);
+         });
+    // none of these mean anything before his first move
+    if (validPlace(whereIs(view, PLAYER_DRACULA))) {
+        TIME("DracView.whereCanDracgo", 1,
+             list = whereCanDracgo(view, &n, TRUE, TRUE); free(list));
+        memcpy(work, trail, sizeof(work));
+        memcpy(hideWork, hideTrail, sizeof(hideWork));
+        TIME("DracView.whereCanIgo", 1,
+             list = whereCanIgo(&n, work, hideWork, whereIs(view, PLAYER_DRACULA), TRUE, TRUE);
+             free(list));
+        memcpy(work, trail, sizeof(work));
+        memcpy(hideWork, hideTrail, sizeof(hideWork));
+        TIME("DracView.fillWhereCanIgo", 1,
+             fillWhereCanIgo(moves, work, hideWork, whereIs(view, PLAYER_DRACULA), TRUE, TRUE));
+    }
+    TIME("DracView.dracViewToState", 1, dracViewToState(view, &state));
+    TIME("DracView.disposeDracView", 1, disposeDracView(view));
+    if (sum == 42) printf(" ");       // keep the getters from being optimised out
+}
+
+static void timeGame(RandomGame *g) {
+    int turn;
+
+    // Dracula's turns, every third one
+    for (turn = NUM_PLAYERS - 1; turn < g->turns; turn += 3 * NUM_PLAYERS) {
+        g->plays[turn * PLAY_SIZE - 1] = '\0';
+        timeView(g->plays);
+        g->plays[turn * PLAY_SIZE - 1] = ' ';
+    }
+}
+
+#else
+
+static void timeGameView(char *plays) {
+    LocationID moves[NUM_MAP_LOCATIONS], trail[TRAIL_SIZE], *list;
+    int numTraps, numVamps, n, sum = 0;
+    LocationID place;
+    PlayerID p;
+    GameView view;
+    Round round;
+
+    TIME("GameView.newGameView", 1, view = newGameView(plays, messages));
+    round = getRound(view);
+    TIME("GameView.getters", 3 + 2 * NUM_PLAYERS,
+         sum += getRound(view) + getCurrentPlayer(view) + getScore(view);
+         for (p = 0; p < NUM_PLAYERS; p++) sum += getHealth(view, p) + getLocation(view, p));
+    TIME("GameView.getMinions", NUM_MAP_LOCATIONS,
+         for (place = 0; place < NUM_MAP_LOCATIONS; place++) {
+             getMinions(view, place, &numTraps, &numVamps);
+         });
+    TIME("GameView.getHistory", NUM_PLAYERS,
+         for (p = 0; p < NUM_PLAYERS; p++) getHistory(view, p, trail));
+    TIME("GameView.connectedLocations", NUM_PLAYERS - 1,
+         for (p = 0; p < PLAYER_DRACULA; p++) {
+             if (!validPlace(getLocation(view, p))) continue;
+             list = connectedLocations(&n, getLocation(view, p), p, round, TRUE, TRUE, TRUE);
+             free(list);
+         });
+    TIME("GameView.fillConnectedLocations", NUM_PLAYERS - 1,
+         for (p = 0; p < PLAYER_DRACULA; p++) {
+             if (!validPlace(getLocation(view, p))) continue;
+             fillConnectedLocations(moves, getLocation(view, p), p, round, TRUE, TRUE, TRUE);
+         });
+    TIME("GameView.disposeGameView", 1, disposeGameView(view));
+    if (sum == 42) printf(" ");
+}
+
+// a hunter's view before their turn
+static void timeHunterView(char *plays) {
+    LocationID moves[NUM_MAP_LOCATIONS], trail[TRAIL_SIZE], *list;
+    int n, sum = 0;
+    PlayerID p;
+    LocationID place;
+    GameState state;
+    DracBelief belief;
+    HunterView view;
+
+    TIME("HunterView.newHunterView", 1, view = newHunterView(plays, messages));
+    TIME("HunterView.getters", 3 + 2 * NUM_PLAYERS,
+         sum += giveMeTheRound(view) + whoAmI(view) + giveMeTheScore(view);
+         for (p = 0; p < NUM_PLAYERS; p++) sum += howHealthyIs(view, p) + whereIs(view, p));
+    TIME("HunterView.giveMeTheTrail", NUM_PLAYERS,
+         for (p = 0; p < NUM_PLAYERS; p++) giveMeTheTrail(view, p, trail));
+    TIME("HunterView.encounters", NUM_MAP_LOCATIONS,
+         for (place = 0; place < NUM_MAP_LOCATIONS; place++) {
+             sum += trailPosition(view, place) + trailMove(view, place);
+         });
+    if (validPlace(whereIs(view, whoAmI(view)))) {
+        TIME("HunterView.whereCanIgo", 1,
+             list = whereCanIgo(view, &n, TRUE, TRUE, TRUE); free(list));
+        TIME("HunterView.fillWhereCanIgo", 1, fillWhereCanIgo(view, moves, TRUE, TRUE, TRUE));
+    }
+    TIME("HunterView.whereCanTheyGo", NUM_PLAYERS - 1,
+         for (p = 0; p < PLAYER_DRACULA; p++) {
+             if (!validPlace(whereIs(view, p))) continue;
+             list = whereCanTheyGo(view, &n, p, TRUE, TRUE, TRUE);
+             free(list);
+         });
+    TIME("HunterView.fillWhereCanTheyGo", NUM_PLAYERS - 1,
+         for (p = 0; p < PLAYER_DRACULA; p++) {
+             if (!validPlace(whereIs(view, p))) continue;
+             fillWhereCanTheyGo(view, moves, p, TRUE, TRUE, TRUE);
+         });
+    TIME("HunterView.hunterViewToState", 1, hunterViewToState(view, &state));
+    TIME("HunterView.whereMightDraculaBe", 1, whereMightDraculaBe(view, &belief));
+    TIME("HunterView.disposeHunterView", 1, disposeHunterView(view));
+    if (sum == 42) printf(" ");
+}
+
+static void timeGame(RandomGame *g) {
+    GameView view;
+    HunterView grown;
+    DracBelief belief;
+    char play[PLAY_SIZE];
+    int turn;
+
+    for (turn = 1; turn < g->turns; turn += TURN_STRIDE) {
+        g->hunterPlays[turn * PLAY_SIZE - 1] = '\0';
+        timeGameView(g->hunterPlays);
+        if (turn % NUM_PLAYERS != PLAYER_DRACULA) timeHunterView(g->hunterPlays);
+        g->hunterPlays[turn * PLAY_SIZE - 1] = ' ';
+    }
+
+    // the whole game again, a play at a time
+    view = newGameView("", messages);
+    play[PLAY_SIZE - 1] = '\0';
+    for (turn = 0; turn < g->turns; turn++) {
+        memcpy(play, &g->hunterPlays[turn * PLAY_SIZE], PLAY_SIZE - 1);
+        TIME("GameView.appendPlays", 1, appendPlays(view, play, messages));
+    }
+    disposeGameView(view);
+
+    // and a hunter's view grown the same way, asked where Dracula might
+    //  be after every play (so the belief is only ever moved on)
+    grown = newHunterView("", messages);
+    whereMightDraculaBe(grown, &belief);
+    for (turn = 0; turn < g->turns; turn++) {
+        memcpy(play, &g->hunterPlays[turn * PLAY_SIZE], PLAY_SIZE - 1);
+        TIME("HunterView.grownBelief", 1,
+             appendHunterPlays(grown, play, messages); whereMightDraculaBe(grown, &belief));
+    }
+    disposeHunterView(grown);
+}
+
+#endif
+
+
+//// Calibration
+
+static void makeCalibrationTable(void) {
+    unsigned int i, x = 1;
+
+    for (i = 0; i < CALIBRATION_SIZE; i++) {
+        x = x * 1103515245 + 12345;
+        calibrationTable[i] = x >> 8;
+    }
+}
+
+// each load depends on the one before, so the loop can't go any faster
+//  than the machine's caches and arithmetic let it
+static unsigned int calibrationLoop(void) {
+    unsigned int i, at = 0, sum = 0;
+
+    for (i = 0; i < CALIBRATION_STEPS; i++) {
+        at = (calibrationTable[at] + i) & (CALIBRATION_SIZE - 1);
+        sum += at;
+    }
+    return sum;
+}
+
+
+//// Reporting
+
+// the baseline time for name, or -1 if it has none
+static double baselineTime(char *file, char *name) {
+    char line[2 * MAX_NAME], entry[MAX_NAME];
+    double ns, found = -1;
+    FILE *in = fopen(file, "r");
+
+    if (in == NULL) {
+        perror(file);
+        exit(EXIT_FAILURE);
+    }
+    while (fgets(line, sizeof(line), in) != NULL) {
+        if (line[0] == '#') continue;
+        if (sscanf(line, "%63s %lf", entry, &ns) == 2 && strcmp(entry, name) == 0) found = ns;
+    }
+    fclose(in);
+    return found;
+}
+
+// compare with the baseline, returning how many functions got slower
+static int compare(char *file, double threshold) {
+    int slower = 0, i;
+    double base, scale = 1;
+
+    base = baselineTime(file, CALIBRATION);
+    if (base > 0) {
+        scale = timer(CALIBRATION)->best / base;
+        fprintf(out, "# this machine takes %.2f times as long as the baseline's (calibration loop)\n",
+                scale);
+    } else {
+        fprintf(out, "# the baseline has no %s, so its times are compared as they are\n", CALIBRATION);
+    }
+    fprintf(out, "%-36s %12s %12s %7s\n", "function", "baseline ns", "now ns", "ratio");
+    for (i = 0; i < numTimed; i++) {
+        if (strcmp(timed[i].name, CALIBRATION) == 0) continue;
+        base = baselineTime(file, timed[i].name);
+        if (base < 0) {
+            fprintf(out, "%-36s %12s %12.1f %7s\n", timed[i].name, "-", timed[i].best, "new");
+            continue;
+        }
+        base *= scale;
+        fprintf(out, "%-36s %12.1f %12.1f %7.2f", timed[i].name, base, timed[i].best, timed[i].best / base);
+        if (timed[i].best > base * threshold && timed[i].best - base > MIN_SLOWDOWN_NS) {
+            fprintf(out, "  SLOWER");
+            slower++;
+        }
+        fprintf(out, "\n");
+    }
+    if (slower > 0) {
+        fprintf(out, "%d function%s more than %.2f times slower than the baseline\n",
+               slower, (slower == 1) ? " is" : "s are", threshold);
+    }
+    return slower;
+}
+
+int main(int argc, char *argv[]) {
+    int numGames = 10, seed = 1, repeats = 3, status = EXIT_SUCCESS, game, run, opt, i;
+    double threshold = 1.5;
+    char *baseline = NULL;
+    long plays = 0;
+    unsigned int sum = 0;
+    RandomGame *games;
+
+    while ((opt = getopt(argc, argv, "n:s:r:c:x:")) != -1) {
+        switch (opt) {
+            case 'n': numGames = atoi(optarg); break;
+            case 's': seed = atoi(optarg); break;
+            case 'r': repeats = atoi(optarg); break;
+            case 'c': baseline = optarg; break;
+            case 'x': threshold = atof(optarg); break;
+            default:
+                fprintf(stderr, "usage: %s [-n games] [-s seed] [-r repeats] "
+                        "[-c baseline file] [-x threshold]\n", argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+    if (numGames < 1) numGames = 1;
+    if (repeats < 1) repeats = 1;
+
+    // whereCanIgo() and some others print as they go, so the results are
+    //  written to a copy of stdout and stdout itself thrown away
+    out = fdopen(dup(STDOUT_FILENO), "w");
+    if (out == NULL || freopen("/dev/null", "w", stdout) == NULL) {
+        perror("stdout");
+        return EXIT_FAILURE;
+    }
+
+    games = malloc(numGames * sizeof(RandomGame));
+    if (games == NULL) {
+        perror("games");
+        return EXIT_FAILURE;
+    }
+    for (game = 0; game < numGames; game++) {
+        makeRandomGame(&games[game], seed + game, 0);
+        plays += games[game].turns;
+    }
+    makeCalibrationTable();
+
+    for (run = 0; run < repeats; run++) {
+        for (i = 0; i < numTimed; i++) {
+            timed[i].ns = 0;
+            timed[i].calls = 0;
+        }
+        TIME(CALIBRATION, 1, sum += calibrationLoop());
+        for (game = 0; game < numGames; game++) timeGame(&games[game]);
+        for (i = 0; i < numTimed; i++) {
+            double ns = timed[i].calls ? timed[i].ns / timed[i].calls : 0;
+            if (timed[i].best < 0 || ns < timed[i].best) timed[i].best = ns;
+        }
+    }
+    free(games);
+    if (sum == 42) printf(" ");
+
+    fprintf(out, "# %s: %d games from seed %d, %.1f rounds on average, best of %d runs\n",
+           argv[0], numGames, seed, (double)plays / numGames / NUM_PLAYERS, repeats);
+    if (baseline != NULL) {
+        status = compare(baseline, threshold) ? EXIT_FAILURE : EXIT_SUCCESS;
+    } else {
+        for (i = 0; i < numTimed; i++) fprintf(out, "%s %.1f\n", timed[i].name, timed[i].best);
+    }
+    fclose(out);
+    return status;
+}
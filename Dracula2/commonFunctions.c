@@ -7,22 +7,27 @@
 #include "Places.h"
 #include "Globals.h"
 #include "GameView.h"
+#include "Distances.h"
+#include "LocSet.h"
+#include "Trace.h"
 #include <time.h>
 
 //count the number of nearby cities of a specified location and
 // store the nearby cities in an array
 LocationID *NearbyCities(Map map, LocationID from,
                          LocationID *nearby, int *size, int type) {
-    VList curr;
+    EdgeIter it;
+    LocationID to;
+    TransportID by;
 
     // traverse the neighbour of the city and renew the size and
     //  array when a new nearby city of type "type" is found
-    for(curr = map->connections[from]; curr != NULL; curr = curr->next) {
-        if (curr->type == type || curr->type == ANY) {
+    for(startEdges(map, from, &it); nextEdge(&it, &to, &by); ) {
+        if (by == type || by == ANY) {
             (*size)++;
             nearby = realloc(nearby, (*size) * sizeof(LocationID));
             assert(nearby != NULL);
-            nearby[*size - 1] = curr->v;
+            nearby[*size - 1] = to;
         }
     }
     return nearby;
@@ -53,27 +58,24 @@ void shiftRight(LocationID *array, int start, int end) {
 
 //given an "other" location abbreviation, return its ID number
 LocationID otherToID(char *abbrev) {
-    if (strcmp(abbrev, "C?") == 0) {
-        return CITY_UNKNOWN;
-    } else if (strcmp(abbrev,"S?") == 0) {
-        return SEA_UNKNOWN;
-    } else if (strcmp(abbrev,"HI") == 0) {
-        return HIDE;
-    } else if (strcmp(abbrev,"D1") == 0) {
-        return DOUBLE_BACK_1;
-    } else if (strcmp(abbrev,"D2") == 0) {
-        return DOUBLE_BACK_2;
-    } else if (strcmp(abbrev,"D3") == 0) {
-        return DOUBLE_BACK_3;
-    } else if (strcmp(abbrev,"D4") == 0) {
-        return DOUBLE_BACK_4;
-    } else if (strcmp(abbrev,"D5") == 0) {
-        return DOUBLE_BACK_5;
-    } else if (strcmp(abbrev,"TP") == 0) {
-        return TELEPORT;
-    } else {
-        return abbrevToID(abbrev);
+    switch (abbrev[0]) {
+        case 'C':
+            if (abbrev[1] == '?') return CITY_UNKNOWN;
+            break;
+        case 'S':
+            if (abbrev[1] == '?') return SEA_UNKNOWN;
+            break;
+        case 'H':
+            if (abbrev[1] == 'I') return HIDE;
+            break;
+        case 'D':
+            if (abbrev[1] >= '1' && abbrev[1] <= '5') return DOUBLE_BACK_1 + (abbrev[1] - '1');
+            break;
+        case 'T':
+            if (abbrev[1] == 'P') return TELEPORT;
+            break;
     }
+    return abbrevToID(abbrev);
 }
 
 //To count the number of chars in a string
@@ -303,53 +305,25 @@ int QueueIsEmpty(Queue Q)
 // ###########################
 
 
+// where a hunter at "from" should move this turn to get to dest soonest
+// the route comes from hunterRoute(), so it follows the real rail rules
+//  for the round; *pathLength goes up by the number of turns after this one
 LocationID howToGetTo(LocationID dest, LocationID from, int round,
                              int player, int *pathLength, int sea, int train) {
 
     if (dest == from) return dest;
 
-    LocationID seenList[NUM_MAP_LOCATIONS] = {0};
-    LocationID prevList[NUM_MAP_LOCATIONS] = {0};
-    LocationID stepList[NUM_MAP_LOCATIONS] = {0}; 
-    Queue toVisit = newQueue();
-    Map map = newRailMap();
-//    int steps = (round+player)%4; 
-
-    seenList[from] = 1 + train - train;
-    prevList[from] = -1;
-
-    if (train)                                    // move by train
-        stepList[from] = (round+player)%4;
-    QueueJoin(toVisit,from);
-    VList i;
-  
-    while(!QueueIsEmpty(toVisit) && !seenList[dest]) {      // while queue !empty & dest !reached
-  
-        LocationID curr = QueueLeave(toVisit);
-//    printf("Curr = %d\n",curr);
-
-        for (i = map->connections[curr]; i != NULL; i=i->next) {                // loop through adj cities (next moves)
-
-            if ((i->type == BOAT && sea) || i->type == ROAD || (train && stepList[curr]+ RAIL_0 >= i->type)) {
-                if (!seenList[i->v]) {                // if location has not been seen:
-                    seenList[i->v] = 1;                   // Mark location as seen = 1
-                    prevList[i->v] = curr;                // Store location in prevList
-                    if (train)                                       
-                        stepList[i->v] = (stepList[curr] + 1)%4;  
-                }
-                if (seenList[dest]) break;                      // if dest is found, break loop
-                QueueJoin(toVisit,i->v);              // add connection to queue
-            }
-        }
-    }
-    dropQueue(toVisit);
-    LocationID curr = dest;
-    while (prevList[curr] != from) {    // Traversing back
-        curr = prevList[curr];
-	(*pathLength)++;
-    }
+    LocationID path[NUM_MAP_LOCATIONS];
+    int transport = BY_ROAD;
+    if (sea) transport |= BY_SEA;
+    if (train) transport |= BY_RAIL;
 
-    return curr;
+    int length = hunterRoute(from, dest, player, round, transport, path);
+    // somewhere only a boat gets to is still worth heading for
+    if (length == NO_PATH) length = hunterRoute(from, dest, player, round, BY_ANY, path);
+    if (length == NO_PATH) return from;
+    *pathLength += length - 1;
+    return path[1];
 }
 
 int findMostCommon(int *array,int size) {
@@ -372,42 +346,32 @@ int findMostCommon(int *array,int size) {
 }
 
 // Finds # moves to get from src -> dest
-int simpleFindPathLength( LocationID src, LocationID dest)
+int simpleFindPathLength(LocationID src, LocationID dest)
 {
-    Map map = newMap();
-        if (src == dest) return 0;
-    int *visited = calloc(map->nV,sizeof(int));
-    LocationID *tmppath = calloc(map->nV,sizeof(LocationID));
-    Queue q = newQueue();
-    QueueJoin(q,src);
-    int isFound = 0;
-    int length = 0;
-    while (!QueueIsEmpty(q) && !isFound) {
-        LocationID x = QueueLeave(q);
-        visited[x] = 1;
-                VList curr;
-                LocationID y;
-        for (curr = map->connections[x]; curr != NULL; curr = curr->next) {
-                    y = curr->v;
-          if (visited[y]) continue;
-            tmppath[y] = x;
-            if (y == dest) {
-                isFound = 1;
-                break;
-            }
-            if (!visited[y]) {
-                QueueJoin(q,y);
-                visited[y] = 1;
-            }
+    // breadth first over every edge (one rail hop each), with the queue
+    //  and the distances on the stack, so nothing is allocated
+    Map map = sharedMap(ONE_RAIL_MAP);
+    int dist[NUM_MAP_LOCATIONS];
+    LocationID queue[NUM_MAP_LOCATIONS];
+    int head = 0, tail = 0;
+    LocationID x, y;
+    TransportID by;
+    EdgeIter it;
+
+    if (src == dest) return 0;
+    for (x = MIN_MAP_LOCATION; x <= MAX_MAP_LOCATION; x++) dist[x] = -1;
+    dist[src] = 0;
+    queue[tail++] = src;
+    while (head < tail) {
+        x = queue[head++];
+        for (startEdges(map, x, &it); nextEdge(&it, &y, &by); ) {
+            if (dist[y] >= 0) continue;
+            dist[y] = dist[x] + 1;
+            if (y == dest) return dist[y];
+            queue[tail++] = y;
         }
     }
-    if (isFound) {
-      LocationID v;
-      for (v = dest; v != src; v = tmppath[v]) {
-                length++;
-            }
-    }
-    return length;
+    return 0;
 }
 
 
@@ -513,202 +477,48 @@ int PQueueIsEmpty(PQueue PQ)
 }
 
 // find the minimum number of turns required for a player to get to dest from src
+// the answer (and the route, stored in path) comes from the distance tables
 int findPathLength(LocationID src, LocationID dest, PlayerID player, Round round, LocationID *path) {
+    TRACE_SCOPE(TRACE_FIND_PATH_LENGTH);
     assert(validPlace(src));
     assert(validPlace(dest));
 
-    Map map = newMap();
-    path[0] = src;
-    if (src == dest) return 0;
-
-    int numLoc;
-    int *visited = calloc(map->nV,sizeof(int));
-    int *tmp = calloc(map->nV,sizeof(int));
-    int *preVisited = calloc(map->nV,sizeof(int));
-    LocationID *currVisited;
-    LocationID *tmpPath = calloc(map->nV, sizeof(LocationID));
-    int isFound = 0;
-    int length = 0;
-    LocationID x, i;
-
-    preVisited[src] = 1;
-    visited[src] = 1;
-    while (isFound != 1) {
-        for (x = 0; x < map->nV && isFound != 1; x++) {
-            if (preVisited[x]) {
-                currVisited = connectedLocations(&numLoc, x, player,
-                                                round, TRUE, TRUE, TRUE);
-//int a;
-//for (a=0;a<numLoc;a++) {
-  //  printf("adjLoc[%d] = %s\n",a,idToName(currVisited[a]));
-//}
-                preVisited[x] = 0;
-                tmp[x] = 0;
-                for (i = 0; i < numLoc; i++) {
-                    if (currVisited[i] == dest) isFound = 1;
-                    if (!visited[currVisited[i]]) {
-                        tmpPath[currVisited[i]] = x;
-                        tmp[currVisited[i]] = 1;
-                        visited[currVisited[i]] = 1;
-                    }
-                }
-                free(currVisited);
-            }
-        }
-        for (x = 0; x < map->nV && isFound != 1; x++) {
-            if (tmp[x]) preVisited[x] = 1;
-        }
-        round++;
-        length++;
-    }
-    i = length;
-//int a;
-//for (a=0;a<70;a++) {
-  //  printf("tmppath[%d] = %s\n",a,idToName(tmpPath[a]));
-//}
-    for (x = dest; x != src; x = tmpPath[x]) {
-        path[i] = x;
-        i --;
-//printf("%s >", idToName(x));
-        //*nextLoc = x;
-    }
-//printf("%s ", idToName(x));
-    //*nextLoc = path[1];
-    //printf("nextLoc = %s\n", idToName(*nextLoc));
-//printf("findpathlength = %d\n", length);
-    free(tmp);
-    free(preVisited);
-    free(visited);
-    free(tmpPath);
-    disposeMap(map);
-
-    return length;
+    return shortestPath(src, dest, player, round, BY_ANY, path);
 }
 
 
+// find the minimum number of turns required for a hunter to get to dest from src
+// the maps are not needed any more, the answer comes from the distance tables
 int hunterPathLength(Map map, Map railMap, LocationID src, LocationID dest, PlayerID player, Round round, LocationID *path) {
+    TRACE_SCOPE(TRACE_HUNTER_PATH_LENGTH);
     assert(validPlace(src));
     assert(validPlace(dest));
 
-    if (src == dest) return 0;
-
-    int *visited = calloc(map->nV, sizeof(int));
-    int *previsited = calloc(map->nV, sizeof(int));
-    int *newlyvisited = calloc(map->nV, sizeof(int));
-    int isFound = 0;
-    int length = 0;
-LocationID *tmpPath = calloc(map->nV, sizeof(LocationID));
-LocationID x;
-//        printf("railstop = %d\n", railStop);
-//    printf("src is %s, dest is %s, player is %d, ronud is %d\n", idToName(src), idToName(dest), player, round);
-        previsited[src] = 1;
-        newlyvisited[src] = 1;
-        visited[src] = 1;
-
-            while (isFound != 1) {
-                for (x = 0; x < map->nV; x++) {
-                    if (newlyvisited[x]) {
-          //              printf("putting in aaa is %s\n", idToName(x));
-                        isFound = isReachable(map, railMap, x, dest, player, round, previsited, tmpPath);
-                        if (isFound) break;
-                        newlyvisited[x] = 0;
-                     }
-                }
-
-                for (x = 0; x < map->nV && isFound != 1; x++) {
-                    if (visited[x] == 0 && previsited[x] == 1) {
-                        visited[x] = 1;
-                        newlyvisited[x] = 1;
-//tmpPath[
-        //                printf("newlyvisited is %s\n", idToName(x));
-                    }
-                }
-                round++;
-                length++;
-            }
-int i = length;
-for (x = dest; x != src; x = tmpPath[x]) {
-        path[i] = x;
-        i --;
-//printf("%s >", idToName(x));
-        //*nextLoc = x;
-    }
-//printf("%s ", idToName(x));
-    free(previsited);
-    free(newlyvisited);
-    free(visited);
-    //printf("hpathlength = %d\n", length);
-    return length;
+    return shortestPath(src, dest, player, round, BY_ANY, path);
 }
 
 
 
 // check if dest is reacheable in next move
+// every place reachable from src that isn't already marked in previsited
+//  is marked there, with tmpPath recording src as the way it was reached
 int isReachable(Map map, Map railMap, LocationID src, LocationID dest, PlayerID player, Round round, LocationID *previsited,  LocationID *tmpPath) {
+    TRACE_SCOPE(TRACE_IS_REACHABLE);
     assert(validPlace(src));
     assert(validPlace(dest));
 
-    int isFound = 0;
-    int railStop = (round + player) % 4;
-    LocationID w, y, z;
-    VList curr, p, n;
-if (player == PLAYER_DRACULA) railStop = 0;
-//printf("railstop = %d, src = %s, dest = %s\n", railStop, idToName(src), idToName(dest));
-    for (curr = map->connections[src]; curr != NULL && (isFound != 1); curr = curr->next) {
-        if ((player == PLAYER_DRACULA && curr->type == RAIL) ||
-            (player == PLAYER_DRACULA && curr->v == ST_JOSEPH_AND_ST_MARYS)) continue;
-        else {
-            y = curr->v;//printf("0/1railstop = %s\n", idToName(y));printf("railstop = %d\n", railStop);
-//printf("currtype = %d\n", curr->type);
-            if (railStop > 1 && (curr->type == RAIL || curr->type == ANY)) {
-//printf("hasrail = %s\n", idToName(y));
-                for (p = railMap->connections[y]; p != NULL && isFound != 1; p = p->next) {
-                        z = p->v;//printf("2railstop = %s\n", idToName(z));
-                        if ((p->type == RAIL || p->type == ANY) && z != src) {
-                            if (railStop == 3) {
-                                for (n = railMap->connections[z]; n != NULL && isFound != 1; n = n->next) {
-                                    w = n->v; //printf("3railstop = %s\n", idToName(w));
-                                    if ((n->type == RAIL || n->type == ANY) && w != y) {
-                                        if (previsited[w]) continue;
-tmpPath[w] = src;
-                                        if (w == dest) {
-                                            isFound = 1;
-                                            break;
-                                        }
-                                        if (!previsited[w]) {
-                                            previsited[w] = 1;
-                                        }
-                                    }
-                                }
-                            }
-                            if (previsited[z]) continue;
-tmpPath[z] = src;
-                            if (z == dest) {
-                                isFound = 1;
-                                break;
-                            }
-                            if (!previsited[z]) {
-                                previsited[z] = 1;
-                            }
-                        }
-                    }
-                }
-                if (previsited[y]) continue;
-tmpPath[y] = src;
-                if (y == dest) {
-                    isFound = 1;
-                    break;
-                }
-                if (!previsited[y]) {
-                    previsited[y] = 1;
-                }
-            }
-        }
-    if (isFound) {
-        return 1;
-    } else {
-        return 0;
+    LocSet moves = movesFromSet(src, player, round, TRUE, TRUE, TRUE);
+    int isFound;
+    LocationID w;
+
+    removeFromSet(&moves, src);
+    isFound = inSet(moves, dest) && !previsited[dest];
+    while ((w = popFromSet(&moves)) != NOWHERE) {
+        if (previsited[w]) continue;
+        tmpPath[w] = src;
+        previsited[w] = 1;
     }
+    return isFound;
 }
 
 
@@ -764,76 +574,6 @@ void copyArray(int *old, int *new, int size) {
   return;
 }
 
-// make the trail as a linked list
-VList trailAsList(LocationID trail[TRAIL_SIZE], LocationID hideTrail[TRAIL_SIZE]) {
-    VList L = NULL;
-    VList tmp = L;
-    int type, i;
-    
-    for (i = TRAIL_SIZE - 1; i >= 0; i--) {
-        if (hideTrail[i] == HIDE) type = 1;
-        else if (hideTrail[i] > HIDE) type = 2;
-        else type = 0;
-        tmp = listInsert(L, trail[i], type);
-        L = tmp;
-    }
-    return L;
-}
-
-// apppend one location to the head of a list
-VList listInsert(VList L, int v, int type) {
-    VList n = malloc(sizeof(struct vNode));
-    assert(n != NULL);
-    n->v = v;
-    n->type = type;
-    n->next = NULL;
-    VList newL = NULL;
-    if (L == NULL)
-        newL = n;
-    else {
-        n->next = L;
-        newL = n;
-    }
-    return newL;
-}
-
-// free the list
-void freeList(VList L) {
-    if (L != NULL) {
-        VList p = L->next;
-        while (L != NULL) {
-            free(L);
-            L = p;
-        }
-    }
-    return;
-}
-
-// check if there's a double-back or hide in Dracula's trail linked list
-int hasDBOrHIList(VList trailList) {
-    int hide = 0;
-    int douB = 0;
-    int i;
-    VList cur = trailList;
-    for (i = 0; i < TRAIL_SIZE; i++) {
-        if (cur->type == 1) {
-            hide++;
-        } else if (cur->type == 2) {
-            douB++;
-        }
-        cur = cur->next;
-    }
-    if ((hide != 0) && (douB != 0)) {
-        return BOTH_HIDE_AND_DB;
-    } else if (hide != 0) {
-        return HAS_HIDE;
-    } else if (douB != 0) {
-        return HAS_DOUBLE_BACK;
-    } else {
-        return NO_SPECIAL_MOVE;
-    }
-}
-
 // to learn the moving pattern of dracula
 void learnDracMove(LocationID trail[TRAIL_SIZE]) {
    int i;
@@ -12,36 +12,26 @@
 #include "GameView.h"
 
 
-// struct definition of Map
-typedef struct vNode *VList;
-
-struct vNode {
-    LocationID  v;    // ALICANTE, etc
-    TransportID type; // ROAD, RAIL, BOAT
-    VList       next; // link to next node
-};
-
-struct MapRep {
-    int   nV;         // #vertices
-    int   nE;         // #edges
-    VList connections[NUM_MAP_LOCATIONS]; // array of lists
-};
-
-
 // struct definition of gameView
 typedef struct _playerInfo {
     int playerHealth;                      // health of each player
     LocationID playerCurrLocation;         // current loaction of each player
     LocationID playerTrail[TRAIL_SIZE];    // trail location of each player
+    int diedLastTurn;                      // hunter went to hospital on their last play
 } playerInfo;
 
 struct gameView {
     char *pastPlays;                       // string of all plays in the past
+    int nChars;                            // length of pastPlays
+    int maxChars;                          // space allocated for pastPlays
+    int nTurns;                            // number of plays made so far
     int gameScore;                         // current game score
     Round roundNumber;                     // current round number
     PlayerID currentPlayer;                // ID of current player
-    PlayerMessage *messages;               // messages provided by players
     playerInfo *players[NUM_PLAYERS];      // array of player info
+    LocationID dracTrail[TRAIL_SIZE];      // Dracula's trail with hides and double backs resolved
+    int numTraps[NUM_MAP_LOCATIONS];       // traps left in each place
+    int numVamps[NUM_MAP_LOCATIONS];       // immature vampires in each place
 
 };
 
@@ -217,19 +207,4 @@ int hasDBOrHI(LocationID trail[TRAIL_SIZE]);
 int posOfDb(LocationID trail[TRAIL_SIZE]);
 
 
-// make the trail as a linked list
-VList trailAsList(LocationID trail[TRAIL_SIZE], LocationID hideTrail[TRAIL_SIZE]);
-
-
-// apppend one location to the head of a list
-VList listInsert(VList L, int v, int type);
-
-
-// free the list
-void freeList(VList L);
-
-// check if there's a double-back or hide in Dracula's trail linked list
-int hasDBOrHIList(VList trailList);
-
-
 #endif /* commonFunctions_h */
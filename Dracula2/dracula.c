@@ -10,7 +10,18 @@
 #include "Places.h"
 #include "Map.h"
 #include "commonFunctions.h"
+#include "Distances.h"
+#include "LocSet.h"
+#include "DracReach.h"
+#include "DracBook.h"
+#include "TransTable.h"
+#include "GameState.h"
+#include "Trace.h"
 #include <time.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <unistd.h>
+#include <limits.h>
 
 LocationID seaLoc[NUM_SEA] = {0, 4, 7, 10, 23, 32, 33, 43, 48, 64};
 LocationID Island[NUM_ISLAND] = {22, 38, 39, 41, 51, 61};
@@ -163,10 +174,6 @@ LocationID escapeThroughSea(DracView gameState, Map map, Map railMap, LocationID
                             int health, LocationID hTrail[NUM_HUNTERS][TRAIL_SIZE], int hHealth[NUM_HUNTERS],
                             LocationID trail[TRAIL_SIZE], LocationID hideTrail[TRAIL_SIZE], LocationID *path, int area);
 
-// calculate an optimal score for a place which deal with all the factors when going to an empty area
-int bestLocScore(int distFromPlace, int nNextAdj, int possHunt, int numHunt,
-                 int numPossHunt, int locScore, int tuneScore, int distFromHunt, int distAdjust);
-
 // find the shortest and suitable path to escape to an empty area and return the next location in that path
 LocationID escapeToEmptyArea(DracView gameState, Map map, Map railMap, LocationID *adjLoc, int numLoc,
                              Round currRound, int *knownLoc, int knownNumLoc, int distCurrFromHunt,
@@ -235,11 +242,90 @@ LocationID stayOrLeaveCD(DracView gameState, Map map, Map railMap, LocationID *a
 // determine whether dracula should stay in a location to leave traps or not
 int stayToLeaveTrap(DracView gameState, Map map, Map railMap, LocationID dest, int numPossHunt, Round currRound, int *knownLoc, int knownNumLoc, LocationID hTrail[NUM_HUNTERS][TRAIL_SIZE], int hHealth[NUM_HUNTERS], LocationID trail[TRAIL_SIZE], LocationID *path);
 
+// score a move to dest from the position given by trail and hTrail
+// (the one move lookahead, and the leaf evaluation of the search)
+int moveScore(DracView gameState, Map map, Map railMap, LocationID dest, Round currRound,
+              int *knownLoc, int knownNumLoc, int health, int distAdjust,
+              LocationID hTrail[NUM_HUNTERS][TRAIL_SIZE], int hHealth[NUM_HUNTERS],
+              LocationID trail[TRAIL_SIZE], LocationID hideTrail[TRAIL_SIZE], LocationID *path);
+
+// search the moves in adjLoc more and more deeply until the time runs out,
+// registering the best move found after each depth is finished
+LocationID searchBestMove(DracView gameState, Map map, Map railMap, LocationID *adjLoc, int numLoc,
+                          Round currRound, int *knownLoc, int knownNumLoc, int health, int distAdjust,
+                          LocationID hTrail[NUM_HUNTERS][TRAIL_SIZE], int hHealth[NUM_HUNTERS],
+                          LocationID trail[TRAIL_SIZE], LocationID hideTrail[TRAIL_SIZE], LocationID *path);
+
+// the endgame table (see DracBook.h), mapped on the first move of a
+// game, or NULL if there is no book file and the endgame is played
+// without it
+static DracBook book = NULL;
+static int triedBook = 0;
+
+static DracBook dracBook(void) {
+    char path[PATH_MAX];
+
+    if (!triedBook) {
+        bookPath(path, sizeof(path));
+        book = openDracBook(path);
+        if (book == NULL) {
+            fprintf(stderr, "%s: no usable endgame book (make book, or set %s)\n",
+                    path, BOOK_PATH_ENV);
+        }
+        triedBook = 1;
+    }
+    return book;
+}
+
+// let go of the book, so the next game maps it afresh (a new one may
+// have been made since, or the old one be gone)
+void newDraculaGame(void) {
+    if (book != NULL) closeDracBook(book);
+    book = NULL;
+    triedBook = 0;
+}
+
+// keep only the land moves in adjLoc that keep dracula away longest from
+// the two hunters nearest him, according to the endgame table
+// return the number of moves kept
+static int keepLongestEndgame(LocationID *adjLoc, int numLoc, LocationID dCurrLoc, Round currRound,
+                              LocationID hTrail[NUM_HUNTERS][TRAIL_SIZE]) {
+    PlayerID hunter;
+    LocationID nearest[2] = {hTrail[0][0], hTrail[1][0]};
+    int nearestDist[2] = {NUM_MAP_LOCATIONS, NUM_MAP_LOCATIONS};
+    int x, dist, turns, mostTurns = -1, numKept = 0;
+
+    for (hunter = PLAYER_LORD_GODALMING; hunter < NUM_HUNTERS; hunter++) {
+        dist = shortestDistance(hTrail[hunter][0], dCurrLoc, hunter, currRound + 1, BY_ANY);
+        if (dist == NO_PATH) continue;
+        if (dist < nearestDist[0]) {
+            nearest[1] = nearest[0];
+            nearestDist[1] = nearestDist[0];
+            nearest[0] = hTrail[hunter][0];
+            nearestDist[0] = dist;
+        } else if (dist < nearestDist[1]) {
+            nearest[1] = hTrail[hunter][0];
+            nearestDist[1] = dist;
+        }
+    }
+    for (x = 0; x < numLoc; x++) {
+        if (idToType(adjLoc[x]) == SEA) continue;
+        turns = bookEndgame(dracBook(), adjLoc[x], nearest[0], nearest[1]);
+        if (turns > mostTurns) {
+            mostTurns = turns;
+            numKept = 0;
+        }
+        if (turns == mostTurns) adjLoc[numKept++] = adjLoc[x];
+    }
+    return numKept;
+}
+
 void decideDraculaMove(DracView gameState)
 {
+    TRACE_MOVE();
     PlayerID hunter;
     LocationID x, currLoc;
-    int y, i;
+    int y;
     int numLoc = 0, count = 0, knownNumLoc;
     LocationID trail[TRAIL_SIZE];
     LocationID hideTrail[TRAIL_SIZE];
@@ -256,8 +342,8 @@ void decideDraculaMove(DracView gameState)
     LocationID *path = calloc(NUM_MAP_LOCATIONS, sizeof(LocationID));
     Round currRound = giveMeTheRound(gameState);
     int health = howHealthyIs(gameState, PLAYER_DRACULA);
-    Map map = newGraph();
-    Map railMap = newRailGraph();
+    Map map = sharedMap(FULL_GRAPH);
+    Map railMap = sharedMap(RAIL_GRAPH);
     LocationID hTrail[NUM_HUNTERS][TRAIL_SIZE];
     int hHealth[NUM_HUNTERS];
     for (hunter = PLAYER_LORD_GODALMING; hunter < NUM_HUNTERS; hunter++) {
@@ -267,7 +353,6 @@ void decideDraculaMove(DracView gameState)
     }
     
     int *knownLoc = knownByHunter(&knownNumLoc, trail, hTrail);
-    int optimalScore, maxOptimalScore = -1000;
     
     
     if (currRound == 0) {
@@ -277,7 +362,7 @@ void decideDraculaMove(DracView gameState)
          } else if (mostIsolatedHunter != -1) {
          LocationID from = hTrail[mostIsolatedHunter][0];
          for (x = MIN_MAP_LOCATION; x < NUM_MAP_LOCATIONS; x++) {
-         if (hunterPathLength(map, railMap, from, x, mostIsolatedHunter, 1, path) == 2) {
+         if (shortestDistance(from, x, mostIsolatedHunter, 1, BY_ANY) == 2) {
          numLoc++;
          if (adjLoc != NULL) {
          adjLoc = realloc(adjLoc, numLoc * sizeof(LocationID));
@@ -335,6 +420,14 @@ void decideDraculaMove(DracView gameState)
                         numLoc--;
                     }
                 }
+                if (dracBook() != NULL) {
+                    numLoc = keepLongestEndgame(adjLoc, numLoc, dCurrLoc, currRound, hTrail);
+                    if (numLoc == 1) {
+                        submitPlay(gameState, adjLoc, map, railMap, path, adjLoc[0], TRUE,
+                                   trail, hideTrail, "Not this time!");
+                        return;
+                    }
+                }
             }
         }
         
@@ -456,39 +549,9 @@ void decideDraculaMove(DracView gameState)
      
         
         // other cases
-        for (i = 0; i < numLoc; i++) {
-            clock_t begin = clock();
-
-            int distFromHunt = distFromNearestHunter(map, railMap, adjLoc[i], path, currRound, hTrail);
-            tmpTrail[0] = adjLoc[i];
-            tmpHideTrail[0] = adjLoc[i];
-            //printf("i = %d, adjLoc = %s\n", i, idToName(adjLoc[i]));
-            int distFromSea = distFromNearestSea(map ,adjLoc[i], tmpTrail, tmpHideTrail);
-            //printf("distFromSea = %d\n", distFromSea);
-            int needHiding;
-            //printf("ha?\n");
-            int nNextAdj = numOfNextAdj(adjLoc[i], trail, hideTrail, &needHiding);
-            //printf("after nnextasj\n");
-            int possHunt = possibleHunters(gameState, adjLoc[i], currRound, hTrail);
-            //printf("after poss\n");
-            int numHunt = numOfHunter(adjLoc[i], hTrail);
-            //printf("after num\n");
-            int numPossHunt = numOfPossHunter(gameState, map, railMap, adjLoc[i], knownLoc,
-                                              knownNumLoc, currRound, trail, hTrail, hHealth, path);
-            int locScore = locationScore(map, adjLoc[i], health, currRound);
-            //printf("passing in need = %d\n", needHiding);
-            int tuneScore = scoreTunner(adjLoc[i], numHunt, possHunt, needHiding,
-                                        knownLoc, knownNumLoc, distFromHunt, trail);
-            optimalScore = optimalLocScore(distFromHunt, nNextAdj, possHunt, numHunt,
-                                           numPossHunt, locScore, tuneScore, distFromSea, distAdjust);
-            clock_t end = clock();
-            double time_spent = (double)(end - begin); // CLOCKS_PER_SEC;
-            printf("ot = %lf\n", time_spent);
-            if (optimalScore > maxOptimalScore) {
-                maxOptimalScore = optimalScore;
-                currLoc = adjLoc[i];
-            }
-        }
+        currLoc = searchBestMove(gameState, map, railMap, adjLoc, numLoc, currRound,
+                                 knownLoc, knownNumLoc, health, distAdjust,
+                                 hTrail, hHealth, trail, hideTrail, path);
         
         /*for (i = 0 ; i < numLoc ; i++) {
          printf("posssssss\n");
@@ -525,8 +588,6 @@ void submitPlay(DracView gameState, LocationID *adjLoc, Map map, Map railMap, Lo
     free(locAbbrev);
     free(adjLoc);
     free(path);
-    disposeMap(map);
-    disposeMap(railMap);
     return;
 }
 
@@ -574,21 +635,24 @@ int *knownByHunter(int *numLoc, LocationID trail[TRAIL_SIZE],
     PlayerID hunter;
     *numLoc = 0;
     int *knownLoc = malloc(TRAIL_SIZE * sizeof(LocationID));
-    int i, j, visited = 0;
+    int i;
+    // seen[i] holds every place a hunter has been in their last i + 1 moves,
+    //  so trail[i] is known if a hunter went there at the same time or later
+    LocSet seen[TRAIL_SIZE];
+    LocSet soFar = emptySet();
     
-    for (i = TRAIL_SIZE; i >= 0; i--) {
-        for (hunter = PLAYER_LORD_GODALMING; hunter <NUM_HUNTERS && visited != 1; hunter++) {
-            for (j = i; j >= 0; j--) {
-                if (((hTrail[hunter][j] == trail[i]) && (trail[i] != UNKNOWN_LOCATION) && (idToType(trail[i]) != SEA)) || trail[i] == CASTLE_DRACULA) {
- 
-                    knownLoc[*numLoc] = i;
-                    (*numLoc)++;
-                    visited = 1;
-                    break;
-                }
-            }
+    for (i = 0; i < TRAIL_SIZE; i++) {
+        for (hunter = PLAYER_LORD_GODALMING; hunter < NUM_HUNTERS; hunter++) {
+            if (validPlace(hTrail[hunter][i])) addToSet(&soFar, hTrail[hunter][i]);
+        }
+        seen[i] = soFar;
+    }
+    for (i = TRAIL_SIZE - 1; i >= 0; i--) {
+        if (trail[i] == CASTLE_DRACULA ||
+            (validPlace(trail[i]) && idToType(trail[i]) != SEA && inSet(seen[i], trail[i]))) {
+            knownLoc[*numLoc] = i;
+            (*numLoc)++;
         }
-        visited = 0;
     }
     //for (i=0;i<(*numLoc);i++) printf("known=trail[%d]", knownLoc[i]);
     return knownLoc;
@@ -620,7 +684,7 @@ PlayerID mostIsolated(Map map, Map railMap, LocationID *path, Round currRound, L
     for (player = PLAYER_LORD_GODALMING; player < NUM_HUNTERS; player++) {
         for (hunter = PLAYER_LORD_GODALMING; hunter < NUM_HUNTERS; hunter++) {
             if (hunter != player) {
-                length = hunterPathLength(map, railMap, hTrail[hunter][0], hTrail[player][0], hunter, currRound + 1, path);
+                length = shortestDistance(hTrail[hunter][0], hTrail[player][0], hunter, currRound + 1, BY_ANY);
                 if (length < nearest) nearest = length;
             }
         }
@@ -649,7 +713,7 @@ LocationID startLocation(Map map, Map railMap, LocationID *path,
         if (idToType(x) == SEA) continue;
         nearestLength = MAX_MAP_LOCATION;
         for (hunter = PLAYER_LORD_GODALMING; hunter < NUM_HUNTERS; hunter++) {
-            length = hunterPathLength(map, railMap, hTrail[hunter][0], x, hunter, 1, path);
+            length = shortestDistance(hTrail[hunter][0], x, hunter, 1, BY_ANY);
             if (length < nearestLength) nearestLength = length;
         }
         //printf("x = %s, nearestlength = %d, maxlength = %d\n", idToName(x), nearestLength, maxLength);
@@ -724,14 +788,16 @@ int locationScore(Map map, LocationID location, int health, Round currRound) {
     int nBoat = 0;        // count the number of baot connections of a place
     int typeScore = 0;
     int locScore = 0;
-    VList cur = map->connections[location];
+    EdgeIter it;
+    LocationID to;
+    TransportID type;
     
-    for (; cur != NULL; cur = cur->next) {
-        if (cur->type == RAIL || cur->type == ANY)
+    for (startEdges(map, location, &it); nextEdge(&it, &to, &type); ) {
+        if (type == RAIL || type == ANY)
             nRail++;
-        if (cur->type == ROAD || cur->type == ANY)
+        if (type == ROAD || type == ANY)
             nRoad++;
-        if (cur->type == BOAT || cur->type == ANY)
+        if (type == BOAT || type == ANY)
             nBoat++;
     }
     if (idToType(location) == SEA) {
@@ -755,21 +821,13 @@ int locationScore(Map map, LocationID location, int health, Round currRound) {
 int possibleHunters(DracView gameState, LocationID place, Round currRound,
                     LocationID hTrail[NUM_HUNTERS][TRAIL_SIZE]) {
     PlayerID hunter;
-    int numLoc;
     int count = 0;
     
     if (idToType(place) == SEA) return 0;
     for (hunter = PLAYER_LORD_GODALMING ; hunter < NUM_HUNTERS; hunter++) {
-        LocationID *futureMove = whereCanTheyGo(gameState, &numLoc,
-                                                hTrail[hunter][0],
-                                                hunter, currRound + 1, TRUE, TRUE, TRUE);
-//        int i;printf("hunter=%d\n",hunter);
-//        for (i=0;i<numLoc;i++) {
-//            printf("possmove=%s\n", idToName(futureMove[i]));
-//        }
-        if (inArray(futureMove, place, numLoc) != -1)
+        if (inSet(movesFromSet(hTrail[hunter][0], hunter, currRound + 1,
+                               TRUE, TRUE, TRUE), place))
             count++;
-        free(futureMove);
     }
     return count;
 }
@@ -814,13 +872,14 @@ int numOfNextAdj(LocationID dest, LocationID trail[TRAIL_SIZE],
     idToAbbrev(dest, locAbbrev);
     LocationID tmpHideTrail[TRAIL_SIZE];
     LocationID tmpTrail[TRAIL_SIZE];
+    LocationID nextAdjLoc[NUM_MAP_LOCATIONS];
     
     copyArray(trail, tmpTrail, TRAIL_SIZE);
     copyArray(hideTrail, tmpHideTrail, TRAIL_SIZE);
        // printf("be4 where i go\n");
     locToDBOrHI(locAbbrev, dest, tmpTrail, tmpHideTrail);
-    whereCanIgo(&numLoc, tmpTrail,
-                tmpHideTrail, dest, TRUE, TRUE);
+    numLoc = fillWhereCanIgo(nextAdjLoc, tmpTrail,
+                             tmpHideTrail, dest, TRUE, TRUE);
     //printf("hideTrail[0] = %d\n", tmpHideTrail[1]);
     if (tmpHideTrail[1] == HIDE) *needHiding = 1;
     else if (tmpHideTrail[1] > HIDE) *needHiding = 2;
@@ -833,8 +892,8 @@ int numOfNextAdj(LocationID dest, LocationID trail[TRAIL_SIZE],
 int shouldTeleport(Map map, Map railMap, LocationID hTrail[NUM_HUNTERS][TRAIL_SIZE], Round currRound, LocationID *path) {
     PlayerID hunter;
     for (hunter = PLAYER_LORD_GODALMING; hunter < NUM_HUNTERS; hunter++) {
-        if (hunterPathLength(map, railMap, hTrail[hunter][0], KLAUSENBURG, hunter, currRound+1, path) <= 3) return 0;
-        if (hunterPathLength(map, railMap, hTrail[hunter][0], GALATZ, hunter, currRound+1, path) <= 3) return 0;
+        if (shortestDistance(hTrail[hunter][0], KLAUSENBURG, hunter, currRound+1, BY_ANY) <= 3) return 0;
+        if (shortestDistance(hTrail[hunter][0], GALATZ, hunter, currRound+1, BY_ANY) <= 3) return 0;
     }
     return 1;
 }
@@ -882,103 +941,23 @@ int distFromNearestHunter(Map map, Map railMap, LocationID location, LocationID
     int length, minLength = NUM_MAP_LOCATIONS;
     
     for (hunter = PLAYER_LORD_GODALMING; hunter < NUM_HUNTERS; hunter++) {
-        length = hunterPathLength(map, railMap, hTrail[hunter][0], location, hunter, round+1, path);
+        length = shortestDistance(hTrail[hunter][0], location, hunter, round+1, BY_ANY);
         if (length < minLength) minLength = length;
     }
     return minLength;
 }
 
 // Finds # moves to get from src -> dest for dracula
+// the trail is where he was before getting to src if src isn't its head
+// returns 20 if he can't get there
 int dracPathLength(Map map, LocationID src, LocationID dest, LocationID trail[TRAIL_SIZE], LocationID hideTrail[TRAIL_SIZE], LocationID *nextLoc, int hideAllow) {
+    TRACE_SCOPE(TRACE_DRAC_PATH_LENGTH);
     if (src == dest) return 0;
     
-    int *visited = calloc(map->nV, sizeof(int));
-    assert(visited != NULL);
-    int *inserted = calloc(map->nV, sizeof(int));
-    assert(inserted != NULL);
-    Queue q = newQueue();
-    QueueJoin(q,src);
-    int i, isFound = 0;
-    int length = 0;
-    int needHiding, type;
-    VList cur, dracPath[NUM_MAP_LOCATIONS];
-    dracPath[src] = trailAsList(trail, hideTrail);
-    visited[src] = 1;
-    inserted[src] = 1;
-    //printf("src=%s, dest=%s, hideAllow=%d\n", idToName(src), idToName(dest), hideAllow);
-    for (cur = dracPath[src]; cur != NULL && cur->v != -1; cur = cur->next) {
-       //printf("%s >>", idToName(cur->v));
-    }
-    //printf("\n");
-    
-    while (!QueueIsEmpty(q) && !isFound) {
-        LocationID x = QueueLeave(q);
-        VList curr;
-        LocationID y;
-        //printf("x = %s\n", idToName(x));
-        for (curr = map->connections[x]; curr != NULL; curr = curr->next) {
-            if (curr->type == RAIL || curr->v == ST_JOSEPH_AND_ST_MARYS) continue;
-            y = curr->v;
-            if (visited[y]) continue;
-            
-            int dbOrHi = hasDBOrHIList(dracPath[x]);
-            needHiding = 0;
-            type = 0;
-            if (dbOrHi != HAS_DOUBLE_BACK || dbOrHi != BOTH_HIDE_AND_DB) {
-                cur = dracPath[x];
-                for (i = 0; i < TRAIL_SIZE - 1; i++) {
-                    if (y == cur->v && cur->type == 0) {
-                        needHiding = 1;
-                        type = 2;
-                    }
-                    cur = cur->next;
-                }
-            }
-            cur = dracPath[x];
-            for (i = 0; i < TRAIL_SIZE - 1; i++) cur = cur->next;
-            while (cur != NULL && cur->v != -1) {
-                visited[cur->v] = 0;
-                cur = cur->next;
-            }
-            //printf("y = %s, needHiding = %d\n", idToName(y), needHiding);
-            if (hideAllow == 0 && needHiding == 1) continue;
-            dracPath[y] = listInsert(dracPath[x], y, type);
-            inserted[y] = 1;
-            if (y == dest) {
-                isFound = 1;
-                //printf("isFound\n");
-                break;
-            }
-            if (!visited[y]) {
-                QueueJoin(q,y);
-                visited[y] = 1;
-            }
-        }
-    }
-    if (isFound) {
-        cur = dracPath[dest];
-        //printf("src is %s, to %s\n", idToName(src), idToName(cur->v));
-        //if (cur->next == NULL) printf("NULL\n");
-        for (cur = dracPath[dest]; cur != NULL && cur->v != -1; cur = cur->next) {
-            //printf("%s >>", idToName(cur->v));
-        }
-        //printf("\n");
-        for (cur = dracPath[dest]; cur->v != src; cur = cur->next) {
-            length++;
-            *nextLoc = cur->v;
-            //printf("%s >", idToName(cur->v));
-        }
-        //printf("%s\n", idToName(src));
-    } else {
-        length = 20;
-    }
-    if (!QueueIsEmpty(q)) dropQueue(q);
-    for (i = 0; i < NUM_MAP_LOCATIONS; i++) {
-        if (inserted[i]) free(dracPath[i]);
-    }
-    free(visited);
-    free(inserted);
-    //printf("dracLength = %d, nextLoc = %s\n", length, idToName(*nextLoc));
+    DracState state = dracState(trail, hideTrail);
+    if (dracStateLocation(state) != src) state = dracMoveTo(state, src);
+    int length = dracDistance(state, dest, hideAllow, nextLoc);
+    if (length == NO_PATH) length = 20;
     return length;
 }
 
@@ -996,7 +975,7 @@ int furthestLength(DracView gameState, Map map, Map railMap, LocationID *adjLoc,
     
     for (i = 0; i < numLoc; i++) {
         for (hunter = PLAYER_LORD_GODALMING; hunter < NUM_HUNTERS; hunter++) {
-            length = hunterPathLength(map, railMap, hTrail[hunter][0], adjLoc[i], hunter, round+1, path);
+            length = shortestDistance(hTrail[hunter][0], adjLoc[i], hunter, round+1, BY_ANY);
             if (length < nearestLength) {
                 nearestLength = length;
                 tmp = adjLoc[i];
@@ -1020,16 +999,16 @@ LocationID predictDracMove(DracView gameState, Map map, Map railMap, LocationID
     int length;
     int nearestLength;
     int maxLength = -1;
-    int numLoc;
-    LocationID *adjLoc = whereCanTheyGo(gameState, &numLoc,
-                                        dracSrc, PLAYER_DRACULA, round,
-                                        TRUE, FALSE, TRUE);
+    LocationID adjLoc[NUM_MAP_LOCATIONS];
+    int numLoc = fillWhereCanTheyGo(gameState, adjLoc,
+                                    dracSrc, PLAYER_DRACULA, round,
+                                    TRUE, FALSE, TRUE);
     int i;
     
     for (i = 0 ; i < numLoc ; i++) {
         nearestLength = MAX_MAP_LOCATION;
         for (hunter = PLAYER_LORD_GODALMING; hunter < NUM_HUNTERS; hunter++) {
-            length = hunterPathLength(map, railMap, hTrail[hunter][currRound - round], adjLoc[i], hunter, round+1, path);
+            length = shortestDistance(hTrail[hunter][currRound - round], adjLoc[i], hunter, round+1, BY_ANY);
             if (length < nearestLength) nearestLength = length;
         }
         if (idToType(adjLoc[i]) == idToType(dracLoc)) {
@@ -1091,7 +1070,7 @@ int hunterDistFromCD(Map map, Map railMap, LocationID *path, Round round,
     int length, minLength = NUM_MAP_LOCATIONS;
     
     for (hunter = PLAYER_LORD_GODALMING; hunter < NUM_HUNTERS; hunter++) {
-        length = hunterPathLength(map, railMap, hTrail[hunter][0], CASTLE_DRACULA, hunter, round+1, path);
+        length = shortestDistance(hTrail[hunter][0], CASTLE_DRACULA, hunter, round+1, BY_ANY);
         if (length < minLength) minLength = length;
     }
     return minLength;
@@ -1125,8 +1104,8 @@ int shouldGoToCD(Map map, Map railMap, LocationID dCurrLoc, LocationID *adjLoc,
     // avoid being surrounded by hunters in CD
     if (dCurrLoc == KLAUSENBURG || dCurrLoc == GALATZ) {
         for (hunter = PLAYER_LORD_GODALMING; hunter < NUM_HUNTERS; hunter++) {
-            if (hunterPathLength(map, railMap, hTrail[hunter][0], KLAUSENBURG, hunter, currRound+1, path) <= 2) return 0;
-            if (hunterPathLength(map, railMap, hTrail[hunter][0], GALATZ, hunter, currRound+1, path) <= 2) return 0;
+            if (shortestDistance(hTrail[hunter][0], KLAUSENBURG, hunter, currRound+1, BY_ANY) <= 2) return 0;
+            if (shortestDistance(hTrail[hunter][0], GALATZ, hunter, currRound+1, BY_ANY) <= 2) return 0;
         }
         return 1;
         //if (huntDistFromCD <= 2) return 0;
@@ -1185,43 +1164,173 @@ int distFromNearestSea(Map map, LocationID location, LocationID trail[TRAIL_SIZE
     return minLength;
 }
 
+/////////////////////////////////////////////////////////
+// Scoring the candidate moves
+//
+// Every escapeTo*() looks at the same things about each place Dracula can
+// move to: how many hunters are there or can get there, how far it is to
+// where he is heading, how many moves he has from there and so on. They
+// are gathered for all the places in one pass into a Candidates, one
+// array for each feature, and each escapeTo*() adjusts the arrays for its
+// own special cases and picks a move with rankedBest() (the isBestLoc()
+// ranking) or weightedBest() (a weighted sum of the features). The
+// weighted sum is one pass along the arrays with no branches, so it could
+// be vectorised at -O2 (the Makefile doesn't optimise).
+
+// gatherCandidates() goal for the nearest sea, wherever it is
+#define NEAREST_SEA     NOWHERE
+
+typedef struct candidates {
+    int n;
+    LocationID place[NUM_MAP_LOCATIONS];
+    int numHunt[NUM_MAP_LOCATIONS];        // hunters there now
+    int numPossHunt[NUM_MAP_LOCATIONS];    // hunters expected to move there
+    int possHunt[NUM_MAP_LOCATIONS];       // hunters who can move there
+    int length[NUM_MAP_LOCATIONS];         // moves from there to the goal
+    int nNextAdj[NUM_MAP_LOCATIONS];       // moves Dracula has from there
+    int needHiding[NUM_MAP_LOCATIONS];     // as numOfNextAdj() sets it
+    int distFromHunt[NUM_MAP_LOCATIONS];   // to the nearest hunter
+    int locScore[NUM_MAP_LOCATIONS];       // locationScore()
+    int tuneScore[NUM_MAP_LOCATIONS];      // scoreTunner(), 0 if not used
+    int score[NUM_MAP_LOCATIONS];          // weighted by weightedBest()
+} Candidates;
+
+// check which moves in adjLoc would have to be a hide or double back
+// (hidden[i] is set for those, if hidden isn't NULL)
+// return 1 if all of them or all but one would, when the way to somewhere
+// is allowed to use hides and double backs
+// tmpTrail and tmpHideTrail are left as the trail after the last move
+static int hideAllowed(LocationID *adjLoc, int numLoc, LocationID trail[TRAIL_SIZE],
+                       LocationID hideTrail[TRAIL_SIZE], LocationID tmpTrail[TRAIL_SIZE],
+                       LocationID tmpHideTrail[TRAIL_SIZE], int *hidden) {
+    char locAbbrev[3];
+    int i, count = 0;
+    
+    for (i = 0; i < numLoc; i++) {
+        idToAbbrev(adjLoc[i], locAbbrev);
+        copyArray(trail, tmpTrail, TRAIL_SIZE);
+        copyArray(hideTrail, tmpHideTrail, TRAIL_SIZE);
+        locToDBOrHI(locAbbrev, adjLoc[i], tmpTrail, tmpHideTrail);
+        if (hidden != NULL) hidden[i] = (tmpHideTrail[0] > MAX_MAP_LOCATION);
+        if (tmpHideTrail[0] > MAX_MAP_LOCATION) count++;
+    }
+    return count >= numLoc - 1;
+}
+
+// fill c with the features of every move in adjLoc, with the length of
+// the way from each to goal (a place, or NEAREST_SEA)
+// tmpTrail and tmpHideTrail are the trail the ways are found with, and
+// get each move put at their head in turn
+// if checkTrap is set a move's numPossHunt is 0 when stayToLeaveTrap()
+// says Dracula should go there to leave a trap
+static void gatherCandidates(Candidates *c, DracView gameState, Map map, Map railMap,
+                             LocationID *adjLoc, int numLoc, LocationID goal, int hideAllow, int checkTrap,
+                             Round currRound, int *knownLoc, int knownNumLoc, int health,
+                             LocationID hTrail[NUM_HUNTERS][TRAIL_SIZE], int hHealth[NUM_HUNTERS],
+                             LocationID trail[TRAIL_SIZE], LocationID hideTrail[TRAIL_SIZE],
+                             LocationID tmpTrail[TRAIL_SIZE], LocationID tmpHideTrail[TRAIL_SIZE], LocationID *path) {
+    LocationID place, nextLoc;
+    int i;
+    
+    c->n = numLoc;
+    for (i = 0; i < numLoc; i++) {
+        place = adjLoc[i];
+        c->place[i] = place;
+        c->numHunt[i] = numOfHunter(place, hTrail);
+        c->numPossHunt[i] = numOfPossHunter(gameState, map, railMap, place, knownLoc,
+                                            knownNumLoc, currRound, trail, hTrail, hHealth, path);
+        c->possHunt[i] = possibleHunters(gameState, place, currRound, hTrail);
+        // stayToLeaveTrap() takes blood off hHealth as it goes, so it is
+        //  asked about each move straight after numOfPossHunter()
+        if (checkTrap && stayToLeaveTrap(gameState, map, railMap, place, c->numPossHunt[i], currRound,
+                                         knownLoc, knownNumLoc, hTrail, hHealth, trail, path) == 1) {
+            c->numPossHunt[i] = 0;
+        }
+        tmpTrail[0] = place;
+        tmpHideTrail[0] = place;
+        if (goal == NEAREST_SEA) {
+            c->length[i] = distFromNearestSea(map, place, tmpTrail, tmpHideTrail);
+        } else {
+            c->length[i] = dracPathLength(map, place, goal, tmpTrail, tmpHideTrail, &nextLoc, hideAllow);
+        }
+        c->nNextAdj[i] = numOfNextAdj(place, trail, hideTrail, &c->needHiding[i]);
+        c->distFromHunt[i] = distFromNearestHunter(map, railMap, place, path, currRound, hTrail);
+        c->locScore[i] = locationScore(map, place, health, currRound);
+        c->tuneScore[i] = 0;
+    }
+}
+
+// the candidate isBestLoc() ranks first, skipping sea moves if landOnly
+// is set, or -1 if there is none
+// minLength is set to the length of the way from it
+static int rankedBest(Candidates *c, int landOnly, int *minLength) {
+    int minNumHunt = NUM_HUNTERS, minNumPossHunt = NUM_HUNTERS, minPossHunt = NUM_HUNTERS;
+    int maxScore = -1000;
+    int i, best = -1;
+    
+    *minLength = NUM_MAP_LOCATIONS;
+    for (i = 0; i < c->n; i++) {
+        if (landOnly && idToType(c->place[i]) == SEA) continue;
+        if (isBestLoc(c->place[i], c->possHunt[i], &minPossHunt, c->numPossHunt[i],
+                      &minNumPossHunt, c->numHunt[i], &minNumHunt, c->length[i],
+                      minLength, c->locScore[i], &maxScore))
+            best = i;
+    }
+    return best;
+}
+
+// the candidate with the highest weighted score, the first of them if
+// there is a tie, or -1 if none scores over -1000
+// distAdjust leaves out the distance from the hunters when they are all
+// far enough away anyway
+static int weightedBest(Candidates *c, int distAdjust) {
+    int huntWeight = distAdjust ? 0 : 30;
+    int i, best = -1, bestScore = -1000;
+    
+    for (i = 0; i < c->n; i++) {
+        c->score[i] = 200 - 10 * c->length[i] + 5 * c->nNextAdj[i] - 40 * c->possHunt[i]
+                      - 8 * c->numHunt[i] - 20 * c->numPossHunt[i] + c->locScore[i]
+                      + c->tuneScore[i] + huntWeight * c->distFromHunt[i];
+    }
+    for (i = 0; i < c->n; i++) {
+        if (c->score[i] > bestScore) {
+            best = i;
+            bestScore = c->score[i];
+        }
+    }
+    return best;
+}
+
+// the dest of escapeTo*() for an area
+static LocationID areaDest(int area) {
+    if (area == RIGHT_EMPTY) return BUCHAREST;
+    if (area == LEFT_EMPTY) return SARAGOSSA;
+    if (area == BOTTOM_EMPTY) return ROME;
+    if (area == TOP_EMPTY) return LONDON;
+    if (area == MIDDLE_EMPTY) return ZURICH;
+    return ATLANTIC_OCEAN;
+}
+
 // find the shortest path to escape to a sea and return the next location in that path
 // minLength is the shortest length required to go to that sea
 LocationID escapeToSea(DracView gameState, Map map, Map railMap, LocationID *adjLoc, int numLoc,
                        int *minLength, Round currRound, int *knownLoc, int knownNumLoc,
                        int health, LocationID hTrail[NUM_HUNTERS][TRAIL_SIZE], int hHealth[NUM_HUNTERS],
                        LocationID trail[TRAIL_SIZE], LocationID hideTrail[TRAIL_SIZE], LocationID tmpTrail[TRAIL_SIZE], LocationID tmpHideTrail[TRAIL_SIZE], LocationID *path) {
-    int x, length;
-    int numHunt, minNumHunt = NUM_HUNTERS;
-    int numPossHunt, minNumPossHunt = NUM_HUNTERS;
-    int possHunt, minPossHunt = NUM_HUNTERS;
-    int locScore, maxScore = -1000;
-    int nNextAdj, needHiding;
-    *minLength = NUM_MAP_LOCATIONS;
-    LocationID currLoc;
+    Candidates c;
+    int i, best;
     int shouldTP = shouldTeleport(map, railMap, hTrail, currRound, path);
     
-    for (x = 0; x < numLoc; x++) {
-        numHunt = numOfHunter(adjLoc[x], hTrail);
-        numPossHunt = numOfPossHunter(gameState, map, railMap, adjLoc[x], knownLoc,
-                                      knownNumLoc, currRound, trail, hTrail, hHealth, path);
-        possHunt = possibleHunters(gameState, adjLoc[x], currRound, hTrail);
-        tmpTrail[0] = adjLoc[x];
-        tmpHideTrail[0] = adjLoc[x];
-        length = distFromNearestSea(map ,adjLoc[x], tmpTrail, tmpHideTrail);
-        locScore = locationScore(map, adjLoc[x], health, currRound);
-        if (adjLoc[x] == CASTLE_DRACULA) possHunt = 3;
-        if (stayToLeaveTrap(gameState, map, railMap, adjLoc[x], numPossHunt, currRound, knownLoc, knownNumLoc, hTrail, hHealth, trail, path) == 1) numPossHunt = 0;
-        nNextAdj = numOfNextAdj(adjLoc[x], trail, hideTrail, &needHiding);
-        if (nNextAdj == 0 && shouldTP == 0) numPossHunt = 2;
-        else if (nNextAdj == 0 && shouldTP == 1) length = 0;
-        
-        if (isBestLoc(adjLoc[x], possHunt, &minPossHunt, numPossHunt,
-                      &minNumPossHunt, numHunt, &minNumHunt, length,
-                      minLength, locScore, &maxScore))
-            currLoc = adjLoc[x];
+    gatherCandidates(&c, gameState, map, railMap, adjLoc, numLoc, NEAREST_SEA, 0, TRUE,
+                     currRound, knownLoc, knownNumLoc, health, hTrail, hHealth,
+                     trail, hideTrail, tmpTrail, tmpHideTrail, path);
+    for (i = 0; i < c.n; i++) {
+        if (c.place[i] == CASTLE_DRACULA) c.possHunt[i] = 3;
+        if (c.nNextAdj[i] == 0 && shouldTP == 0) c.numPossHunt[i] = 2;
+        else if (c.nNextAdj[i] == 0 && shouldTP == 1) c.length[i] = 0;
     }
-    return currLoc;
+    best = rankedBest(&c, FALSE, minLength);
+    return (best == -1) ? adjLoc[0] : c.place[best];
 }
 
 // check if the given dest is a best place among all other places that passed in before
@@ -1304,50 +1413,24 @@ LocationID escapeToCD(DracView gameState, Map map, Map railMap, LocationID *adjL
                       int *minLength, Round currRound, int *knownLoc, int knownNumLoc,
                       int health, LocationID hTrail[NUM_HUNTERS][TRAIL_SIZE], int hHealth[NUM_HUNTERS],
                       LocationID trail[TRAIL_SIZE], LocationID hideTrail[TRAIL_SIZE], LocationID *path) {
-    int numHunt, minNumHunt = NUM_HUNTERS;
-    int numPossHunt, minNumPossHunt = NUM_HUNTERS;
-    int possHunt, minPossHunt = NUM_HUNTERS;
-    int locScore, maxScore = -1000;
-    *minLength = NUM_MAP_LOCATIONS;
-    LocationID currLoc, nextLoc;
     LocationID tmpHideTrail[TRAIL_SIZE];
     LocationID tmpTrail[TRAIL_SIZE];
-    char *locAbbrev = malloc(3 * sizeof(char));
-    int i, hideAllow, nNextAdj, needHiding, lengthToCD, count = 0;
+    Candidates c;
+    int i, best;
+    int hideAllow = hideAllowed(adjLoc, numLoc, trail, hideTrail, tmpTrail, tmpHideTrail, NULL);
     
-    for (i = 0; i < numLoc; i++) {
-        idToAbbrev(adjLoc[i], locAbbrev);
-        copyArray(trail, tmpTrail, TRAIL_SIZE);
-        copyArray(hideTrail, tmpHideTrail, TRAIL_SIZE);
-        locToDBOrHI(locAbbrev, adjLoc[i], tmpTrail, tmpHideTrail);
-        if (tmpHideTrail[0] > MAX_MAP_LOCATION) count++;
-    }
-    free(locAbbrev);
-    if (count >= numLoc - 1) hideAllow = 1;
-    else hideAllow = 0;
-    
-    for (i = 0; i < numLoc; i++) {
-        numHunt = numOfHunter(adjLoc[i], hTrail);
-        numPossHunt = numOfPossHunter(gameState, map, railMap, adjLoc[i], knownLoc,
-                                      knownNumLoc, currRound, trail, hTrail, hHealth, path);
-        possHunt = possibleHunters(gameState, adjLoc[i], currRound, hTrail);
-        nNextAdj = numOfNextAdj(adjLoc[i], trail, hideTrail, &needHiding);
-        tmpTrail[0] = adjLoc[i];
-        tmpHideTrail[0] = adjLoc[i];
-        lengthToCD = dracPathLength(map, adjLoc[i], CASTLE_DRACULA, tmpTrail, tmpHideTrail, &nextLoc, hideAllow);
-        locScore = locationScore(map, adjLoc[i], health, currRound);
-        if (possHunt == 0 && nNextAdj == 0) return adjLoc[i];
-        else if (nNextAdj == 0) {
-            lengthToCD = 1;
-            locScore += 50;
+    gatherCandidates(&c, gameState, map, railMap, adjLoc, numLoc, CASTLE_DRACULA, hideAllow, TRUE,
+                     currRound, knownLoc, knownNumLoc, health, hTrail, hHealth,
+                     trail, hideTrail, tmpTrail, tmpHideTrail, path);
+    for (i = 0; i < c.n; i++) {
+        if (c.possHunt[i] == 0 && c.nNextAdj[i] == 0) return c.place[i];
+        else if (c.nNextAdj[i] == 0) {
+            c.length[i] = 1;
+            c.locScore[i] += 50;
         }
-        if (stayToLeaveTrap(gameState, map, railMap, adjLoc[i], numPossHunt, currRound, knownLoc, knownNumLoc, hTrail, hHealth, trail, path) == 1) numPossHunt = 0;
-        if (isBestLoc(adjLoc[i], possHunt, &minPossHunt, numPossHunt,
-                      &minNumPossHunt, numHunt, &minNumHunt, lengthToCD,
-                      minLength, locScore, &maxScore))
-            currLoc = adjLoc[i];
     }
-    return currLoc;
+    best = rankedBest(&c, FALSE, minLength);
+    return (best == -1) ? adjLoc[0] : c.place[best];
 }
 
 // find the shortest path to escape from a sea to a city
@@ -1355,42 +1438,31 @@ LocationID escapeToCity(DracView gameState, Map map, Map railMap, LocationID *ad
                        Round currRound, int *knownLoc, int knownNumLoc, int distCurrFromHunt,
                        int health, LocationID hTrail[NUM_HUNTERS][TRAIL_SIZE], int hHealth[NUM_HUNTERS],
                        LocationID trail[TRAIL_SIZE], LocationID hideTrail[TRAIL_SIZE], LocationID tmpTrail[TRAIL_SIZE], LocationID tmpHideTrail[TRAIL_SIZE], LocationID *path, int area, int distAdjust) {
-    int x, nNextAdj, nCurrNextAdj, needHiding, currNeedHiding, length, minLength = NUM_MAP_LOCATIONS;
-    int numHunt, minNumHunt = NUM_HUNTERS;
-    int numPossHunt, minNumPossHunt = NUM_HUNTERS;
-    int possHunt, minPossHunt = NUM_HUNTERS;
-    int locScore, maxScore = -1000;
-    LocationID currLoc;
-    int distFromHunt;
+    LocationID landLoc[NUM_MAP_LOCATIONS];
+    LocationID currLoc = adjLoc[0];
+    Candidates c;
+    int i, best, minLength, numLand = 0;
+    int nCurrNextAdj = 0, currNeedHiding = 0, distFromHunt = 0;
     int shouldTP = shouldTeleport(map, railMap, hTrail, currRound, path);
     
-    for (x = 0; x < numLoc; x++) {
-        if (idToType(adjLoc[x]) == SEA) continue;
-        numHunt = numOfHunter(adjLoc[x], hTrail);
-        numPossHunt = numOfPossHunter(gameState, map, railMap, adjLoc[x], knownLoc,
-                                      knownNumLoc, currRound, trail, hTrail, hHealth, path);
-        possHunt = possibleHunters(gameState, adjLoc[x], currRound, hTrail);
-        tmpTrail[0] = adjLoc[x];
-        tmpHideTrail[0] = adjLoc[x];
-        length = distFromNearestSea(map ,adjLoc[x], tmpTrail, tmpHideTrail);
-        locScore = locationScore(map, adjLoc[x], health, currRound);
-        nNextAdj = numOfNextAdj(adjLoc[x], trail, hideTrail, &needHiding);
-        if (stayToLeaveTrap(gameState, map, railMap, adjLoc[x], numPossHunt, currRound, knownLoc, knownNumLoc, hTrail, hHealth, trail, path) == 1) numPossHunt = 0;
-        if (nNextAdj == 0 && shouldTP == 0) numPossHunt = 1;
-        else if (nNextAdj == 0 && shouldTP == 1) length = 0;
-        //printf("escape to city: adjLoc= =%s, numHunt = %d, numPossHunt = %d, possHunt = %d, length = %d, locScore = %d, maxScore = %d\n", idToName(adjLoc[x]), numHunt, numPossHunt, possHunt, length, locScore, maxScore);
-        //printf("escape to cty : minPossHunt = %d, minNumPossHunt = %d, minNumHunt = %d, minLength = %d, maxScore = %d\n", minPossHunt, minNumPossHunt, minNumHunt, minLength, maxScore);
-        if (isBestLoc(adjLoc[x], possHunt, &minPossHunt, numPossHunt,
-                      &minNumPossHunt, numHunt, &minNumHunt, length,
-                      &minLength, locScore, &maxScore)) {
-            currLoc = adjLoc[x];
-            nCurrNextAdj = nNextAdj;
-            currNeedHiding = needHiding;
-            distFromHunt = distFromNearestHunter(map, railMap, adjLoc[x], path, currRound, hTrail);
-        }
+    for (i = 0; i < numLoc; i++) {
+        if (idToType(adjLoc[i]) != SEA) landLoc[numLand++] = adjLoc[i];
     }
-    //printf("needHiding -= %d, nnext = %d\n", needHiding, nNextAdj);
-    if (/*minPossHunt != 0*/(distFromHunt <= 2 || currNeedHiding != 0 || nCurrNextAdj <= 3) && minLength != 0) {
+    gatherCandidates(&c, gameState, map, railMap, landLoc, numLand, NEAREST_SEA, 0, TRUE,
+                     currRound, knownLoc, knownNumLoc, health, hTrail, hHealth,
+                     trail, hideTrail, tmpTrail, tmpHideTrail, path);
+    for (i = 0; i < c.n; i++) {
+        if (c.nNextAdj[i] == 0 && shouldTP == 0) c.numPossHunt[i] = 1;
+        else if (c.nNextAdj[i] == 0 && shouldTP == 1) c.length[i] = 0;
+    }
+    best = rankedBest(&c, TRUE, &minLength);
+    if (best != -1) {
+        currLoc = c.place[best];
+        nCurrNextAdj = c.nNextAdj[best];
+        currNeedHiding = c.needHiding[best];
+        distFromHunt = c.distFromHunt[best];
+    }
+    if ((distFromHunt <= 2 || currNeedHiding != 0 || nCurrNextAdj <= 3) && minLength != 0) {
         
         if (area != CURR_EMPTY && area != -1) {
             currLoc = escapeThroughSea(gameState, map, railMap, adjLoc, numLoc, currRound, knownLoc, knownNumLoc, health, hTrail, hHealth, trail, hideTrail, path, area);
@@ -1407,81 +1479,30 @@ LocationID escapeToCity(DracView gameState, Map map, Map railMap, LocationID *ad
     return currLoc;
 }
 
-// calculate an optimal score for a place which deal with all the factors when going to an empty area
-int bestLocScore(int distFromPlace, int nNextAdj, int possHunt, int numHunt,
-                    int numPossHunt, int locScore, int tuneScore, int distFromHunt, int distAdjust) {
-    int bestScore;
-    if (distAdjust) distFromHunt = 0;
-    bestScore = 200 - 10 * distFromPlace + 5 * nNextAdj - 40 * possHunt - 8 * numHunt - 20 * numPossHunt + locScore + tuneScore + 30 * distFromHunt;
-    
-    return bestScore;
-}
-
 // find the shortest and suitable path to escape to an empty area and return the next location in that path
 LocationID escapeToEmptyArea(DracView gameState, Map map, Map railMap, LocationID *adjLoc, int numLoc,
                          Round currRound, int *knownLoc, int knownNumLoc, int distCurrFromHunt,
                          int health, LocationID hTrail[NUM_HUNTERS][TRAIL_SIZE], int hHealth[NUM_HUNTERS],
                          LocationID trail[TRAIL_SIZE], LocationID hideTrail[TRAIL_SIZE], LocationID *path, int area, int distAdjust) {
-    int length;
-    int numHunt;
-    int numPossHunt;
-    int possHunt;
-    int locScore;
-    LocationID currLoc, nextLoc;
     LocationID tmpHideTrail[TRAIL_SIZE];
     LocationID tmpTrail[TRAIL_SIZE];
-    char *locAbbrev = malloc(3 * sizeof(char));
-    int i, hideAllow, count = 0;
-    int nNextAdj, needHiding;
-    int tmpScore, bestScore = -1000;
-    int distFromHunt ,tuneScore;
-    LocationID dest = ATLANTIC_OCEAN;
+    Candidates c;
+    int i, best;
+    int hideAllow = hideAllowed(adjLoc, numLoc, trail, hideTrail, tmpTrail, tmpHideTrail, NULL);
     int shouldTP = shouldTeleport(map, railMap, hTrail, currRound, path);
     
-    if (area == RIGHT_EMPTY) dest = BUCHAREST;
-    else if (area == LEFT_EMPTY) dest = SARAGOSSA;
-    else if (area == BOTTOM_EMPTY) dest = ROME;
-    else if (area == TOP_EMPTY) dest = LONDON;
-    else if (area == MIDDLE_EMPTY) dest = ZURICH;
-    
-    for (i = 0; i < numLoc; i++) {
-        idToAbbrev(adjLoc[i], locAbbrev);
-        copyArray(trail, tmpTrail, TRAIL_SIZE);
-        copyArray(hideTrail, tmpHideTrail, TRAIL_SIZE);
-        locToDBOrHI(locAbbrev, adjLoc[i], tmpTrail, tmpHideTrail);
-        if (tmpHideTrail[0] > MAX_MAP_LOCATION) count++;
+    gatherCandidates(&c, gameState, map, railMap, adjLoc, numLoc, areaDest(area), hideAllow, TRUE,
+                     currRound, knownLoc, knownNumLoc, health, hTrail, hHealth,
+                     trail, hideTrail, tmpTrail, tmpHideTrail, path);
+    for (i = 0; i < c.n; i++) {
+        c.tuneScore[i] = scoreTunner(c.place[i], c.numHunt[i], c.possHunt[i], c.needHiding[i],
+                                     knownLoc, knownNumLoc, distCurrFromHunt, trail);
+        if (c.needHiding[i] != 0) c.locScore[i] -= 40;
+        if (c.nNextAdj[i] == 0 && shouldTP == 0) c.locScore[i] -= 200;
+        else if (c.nNextAdj[i] == 0 && shouldTP == 1) c.locScore[i] += 200;
     }
-    free(locAbbrev);
-    if (count >= numLoc - 1) hideAllow = 1;
-    else hideAllow = 0;
-    
-    for (i = 0; i < numLoc; i++) {
-        numHunt = numOfHunter(adjLoc[i], hTrail);
-        numPossHunt = numOfPossHunter(gameState, map, railMap, adjLoc[i], knownLoc,
-                                      knownNumLoc, currRound, trail, hTrail, hHealth, path);
-        possHunt = possibleHunters(gameState, adjLoc[i], currRound, hTrail);
-        tmpTrail[0] = adjLoc[i];
-        tmpHideTrail[0] = adjLoc[i];
-        length = dracPathLength(map, adjLoc[i], dest, tmpTrail, tmpHideTrail, &nextLoc, hideAllow);
-        nNextAdj = numOfNextAdj(adjLoc[i], trail, hideTrail, &needHiding);
-        distFromHunt = distFromNearestHunter(map, railMap, adjLoc[i], path, currRound, hTrail);
-        locScore = locationScore(map, adjLoc[i], health, currRound);
-        tuneScore = scoreTunner(adjLoc[i], numHunt, possHunt, needHiding,
-                                knownLoc, knownNumLoc, distCurrFromHunt, trail);
-        if (needHiding != 0) locScore -= 40;
-        if (nNextAdj == 0 && shouldTP == 0) locScore -= 200;
-        else if (nNextAdj == 0 && shouldTP == 1) locScore += 200;
-        if (stayToLeaveTrap(gameState, map, railMap, adjLoc[i], numPossHunt, currRound, knownLoc, knownNumLoc, hTrail, hHealth, trail, path) == 1) numPossHunt = 0;
-        
-        tmpScore = bestLocScore(length, nNextAdj, possHunt, numHunt,
-                                numPossHunt, locScore, tuneScore, distFromHunt, distAdjust);
-        if (tmpScore > bestScore) {
-            currLoc = adjLoc[i];
-            bestScore = tmpScore;
-        }
-    }
-    
-    return currLoc;
+    best = weightedBest(&c, distAdjust);
+    return (best == -1) ? adjLoc[0] : c.place[best];
 }
 
 // find a suitable path to escape to an empty area through sea and return the next location in that path
@@ -1489,76 +1510,25 @@ LocationID escapeThroughSea(DracView gameState, Map map, Map railMap, LocationID
                              Round currRound, int *knownLoc, int knownNumLoc,
                              int health, LocationID hTrail[NUM_HUNTERS][TRAIL_SIZE], int hHealth[NUM_HUNTERS],
                              LocationID trail[TRAIL_SIZE], LocationID hideTrail[TRAIL_SIZE], LocationID *path, int area) {
-    int length;
-    int numHunt;
-    int numPossHunt;
-    int possHunt;
-    int locScore;
-    LocationID currLoc, nextLoc;
     LocationID tmpHideTrail[TRAIL_SIZE];
     LocationID tmpTrail[TRAIL_SIZE];
-    char *locAbbrev = malloc(3 * sizeof(char));
-    int i, hideAllow, count = 0;
-    int nNextAdj, needHiding;
-    int tmpScore, bestScore = -1000;
-    int distFromHunt ,tuneScore = 0;
-    LocationID dest = ATLANTIC_OCEAN;
+    Candidates c;
+    int i, best;
+    int hideAllow = hideAllowed(adjLoc, numLoc, trail, hideTrail, tmpTrail, tmpHideTrail, NULL);
     int shouldTP = shouldTeleport(map, railMap, hTrail, currRound, path);
-    //int *hideArray = calloc(numLoc, sizeof(int));
-    
-    if (area == RIGHT_EMPTY) dest = BUCHAREST;
-    else if (area == LEFT_EMPTY) dest = SARAGOSSA;
-    else if (area == BOTTOM_EMPTY) dest = ROME;
-    else if (area == TOP_EMPTY) dest = LONDON;
-    else if (area == MIDDLE_EMPTY) dest = ZURICH;
-    
-    for (i = 0; i < numLoc; i++) {
-        idToAbbrev(adjLoc[i], locAbbrev);
-        copyArray(trail, tmpTrail, TRAIL_SIZE);
-        copyArray(hideTrail, tmpHideTrail, TRAIL_SIZE);
-        locToDBOrHI(locAbbrev, adjLoc[i], tmpTrail, tmpHideTrail);
-        if (tmpHideTrail[0] > MAX_MAP_LOCATION) {
-            count++;
-            //hideArray[i] = 1;
-        }
-    }
-    free(locAbbrev);
-    if (count >= numLoc - 1) hideAllow = 1;
-    else hideAllow = 0;
     
-    for (i = 0; i < numLoc; i++) {
-        numHunt = numOfHunter(adjLoc[i], hTrail);
-        numPossHunt = numOfPossHunter(gameState, map, railMap, adjLoc[i], knownLoc,
-                                      knownNumLoc, currRound, trail, hTrail, hHealth, path);
-        possHunt = possibleHunters(gameState, adjLoc[i], currRound, hTrail);
-        tmpTrail[0] = adjLoc[i];
-        tmpHideTrail[0] = adjLoc[i];
-        length = dracPathLength(map, adjLoc[i], dest, tmpTrail, tmpHideTrail, &nextLoc, hideAllow);
-        nNextAdj = numOfNextAdj(adjLoc[i], trail, hideTrail, &needHiding);
-        locScore = locationScore(map, adjLoc[i], health, currRound);
-        //tuneScore = scoreTunner(adjLoc[i], numHunt, possHunt, needHiding,
-          //                      knownLoc, knownNumLoc, distCurrFromHunt, trail);
-        if (needHiding != 0/*hideArray[i] == 1*/) locScore -= 40;
-        if (nNextAdj == 0 && shouldTP == 0) locScore -= 200;
-        else if (nNextAdj == 0 && shouldTP == 1) locScore += 200;
-        if (idToType(adjLoc[i]) == SEA) locScore += 100;
-        else if (stayToLeaveTrap(gameState, map, railMap, adjLoc[i], numPossHunt, currRound, knownLoc, knownNumLoc, hTrail, hHealth, trail, path) == 1) numPossHunt = 0;
-        distFromHunt = distFromNearestHunter(map, railMap, adjLoc[i], path, currRound, hTrail);
-        
-        tmpScore = bestLocScore(length, nNextAdj, possHunt, numHunt,
-                                numPossHunt, locScore, tuneScore, distFromHunt, 0);
-        if (tmpScore > bestScore) {
-            currLoc = adjLoc[i];
-            bestScore = tmpScore;
-        }
-        //        if (isBestLoc(adjLoc[i], possHunt, &minPossHunt, numPossHunt,
-        //                      &minNumPossHunt, numHunt, &minNumHunt, length,
-        //                      &minLength, locScore, &maxScore))
-        //            currLoc = adjLoc[i];
+    // (stayToLeaveTrap() never picks a sea)
+    gatherCandidates(&c, gameState, map, railMap, adjLoc, numLoc, areaDest(area), hideAllow, TRUE,
+                     currRound, knownLoc, knownNumLoc, health, hTrail, hHealth,
+                     trail, hideTrail, tmpTrail, tmpHideTrail, path);
+    for (i = 0; i < c.n; i++) {
+        if (c.needHiding[i] != 0) c.locScore[i] -= 40;
+        if (c.nNextAdj[i] == 0 && shouldTP == 0) c.locScore[i] -= 200;
+        else if (c.nNextAdj[i] == 0 && shouldTP == 1) c.locScore[i] += 200;
+        if (idToType(c.place[i]) == SEA) c.locScore[i] += 100;
     }
-  
-    //free(hideArray);
-    return currLoc;
+    best = weightedBest(&c, 0);
+    return (best == -1) ? adjLoc[0] : c.place[best];
 }
 
 
@@ -1567,67 +1537,49 @@ LocationID escapeToRight(DracView gameState, Map map, Map railMap, LocationID *a
                         Round currRound, int *knownLoc, int knownNumLoc, int distCurrFromHunt,
                         int health, LocationID hTrail[NUM_HUNTERS][TRAIL_SIZE], int hHealth[NUM_HUNTERS],
                         LocationID trail[TRAIL_SIZE], LocationID hideTrail[TRAIL_SIZE], LocationID *path) {
-    int length;
-    int numHunt;
-    int numPossHunt;
-    int possHunt;
-    int locScore;
-    LocationID currLoc, nextLoc;
     LocationID tmpHideTrail[TRAIL_SIZE];
     LocationID tmpTrail[TRAIL_SIZE];
-    char *locAbbrev = malloc(3 * sizeof(char));
-    int i, hideAllow, count = 0;
-    int nNextAdj, needHiding;
-    int tmpScore, bestScore = -1000;
-    int distFromHunt ,tuneScore;
-    //int *hideArray = calloc(numLoc, sizeof(int));
-    
-    for (i = 0; i < numLoc; i++) {
-        idToAbbrev(adjLoc[i], locAbbrev);
-        copyArray(trail, tmpTrail, TRAIL_SIZE);
-        copyArray(hideTrail, tmpHideTrail, TRAIL_SIZE);
-        locToDBOrHI(locAbbrev, adjLoc[i], tmpTrail, tmpHideTrail);
-        if (tmpHideTrail[0] > MAX_MAP_LOCATION) {
-            count++;
-            //hideArray[i] = 1;
-        }
-    }
-    free(locAbbrev);
-    if (count >= numLoc - 1) hideAllow = 1;
-    else hideAllow = 0;
+    Candidates c;
+    int i, best;
+    int hideAllow = hideAllowed(adjLoc, numLoc, trail, hideTrail, tmpTrail, tmpHideTrail, NULL);
     
     int distAdjust = 0;
     if (isFarAwayEnough(map, railMap, adjLoc, numLoc, path, currRound, hTrail)) distAdjust = 1;
     
-    for (i = 0; i < numLoc; i++) {
-        numHunt = numOfHunter(adjLoc[i], hTrail);
-        numPossHunt = numOfPossHunter(gameState, map, railMap, adjLoc[i], knownLoc,
-                                      knownNumLoc, currRound, trail, hTrail, hHealth, path);
-        possHunt = possibleHunters(gameState, adjLoc[i], currRound, hTrail);
-        tmpTrail[0] = adjLoc[i];
-        tmpHideTrail[0] = adjLoc[i];
-        length = dracPathLength(map, adjLoc[i], BUCHAREST, tmpTrail, tmpHideTrail, &nextLoc, hideAllow);
-        nNextAdj = numOfNextAdj(adjLoc[i], trail, hideTrail, &needHiding);
-        locScore = locationScore(map, adjLoc[i], health, currRound);
-        tuneScore = scoreTunner(adjLoc[i], numHunt, possHunt, needHiding,
-                                                knownLoc, knownNumLoc, distCurrFromHunt, trail);
-        if (needHiding != 0/*hideArray[i] == 1*/) locScore -= 40;
-        distFromHunt = distFromNearestHunter(map, railMap, adjLoc[i], path, currRound, hTrail);
-        
-        tmpScore = bestLocScore(length, nNextAdj, possHunt, numHunt,
-                                numPossHunt, locScore, tuneScore, distFromHunt, distAdjust);
-        if (tmpScore > bestScore) {
-            currLoc = adjLoc[i];
-            bestScore = tmpScore;
-        }
-//        if (isBestLoc(adjLoc[i], possHunt, &minPossHunt, numPossHunt,
-//                      &minNumPossHunt, numHunt, &minNumHunt, length,
-//                      &minLength, locScore, &maxScore))
-//            currLoc = adjLoc[i];
+    gatherCandidates(&c, gameState, map, railMap, adjLoc, numLoc, BUCHAREST, hideAllow, FALSE,
+                     currRound, knownLoc, knownNumLoc, health, hTrail, hHealth,
+                     trail, hideTrail, tmpTrail, tmpHideTrail, path);
+    for (i = 0; i < c.n; i++) {
+        c.tuneScore[i] = scoreTunner(c.place[i], c.numHunt[i], c.possHunt[i], c.needHiding[i],
+                                     knownLoc, knownNumLoc, distCurrFromHunt, trail);
+        if (c.needHiding[i] != 0) c.locScore[i] -= 40;
     }
+    best = weightedBest(&c, distAdjust);
+    return (best == -1) ? adjLoc[0] : c.place[best];
+}
+
+// find the shortest path to escape towards dest and return the next location in that path
+// (escapeToLeft(), escapeToBottom(), escapeToTop() and escapeToMiddle()
+// only differ in dest and in how much worse a hide or double back is)
+static LocationID escapeTowards(DracView gameState, Map map, Map railMap, LocationID *adjLoc, int numLoc,
+                                LocationID dest, int hidePenalty, Round currRound, int *knownLoc, int knownNumLoc,
+                                int health, LocationID hTrail[NUM_HUNTERS][TRAIL_SIZE], int hHealth[NUM_HUNTERS],
+                                LocationID trail[TRAIL_SIZE], LocationID hideTrail[TRAIL_SIZE], LocationID *path) {
+    LocationID tmpHideTrail[TRAIL_SIZE];
+    LocationID tmpTrail[TRAIL_SIZE];
+    int hidden[NUM_MAP_LOCATIONS];
+    Candidates c;
+    int i, best, minLength;
+    int hideAllow = hideAllowed(adjLoc, numLoc, trail, hideTrail, tmpTrail, tmpHideTrail, hidden);
     
-    //free(hideArray);
-    return currLoc;
+    gatherCandidates(&c, gameState, map, railMap, adjLoc, numLoc, dest, hideAllow, FALSE,
+                     currRound, knownLoc, knownNumLoc, health, hTrail, hHealth,
+                     trail, hideTrail, tmpTrail, tmpHideTrail, path);
+    for (i = 0; i < c.n; i++) {
+        if (hidden[i]) c.locScore[i] -= hidePenalty;
+    }
+    best = rankedBest(&c, FALSE, &minLength);
+    return (best == -1) ? adjLoc[0] : c.place[best];
 }
 
 // find the shortest path to escape to left area and return the next location in that path
@@ -1635,52 +1587,8 @@ LocationID escapeToLeft(DracView gameState, Map map, Map railMap, LocationID *ad
                        Round currRound, int *knownLoc, int knownNumLoc, int distCurrFromHunt,
                        int health, LocationID hTrail[NUM_HUNTERS][TRAIL_SIZE], int hHealth[NUM_HUNTERS],
                        LocationID trail[TRAIL_SIZE], LocationID hideTrail[TRAIL_SIZE], LocationID *path) {
-    int length, minLength = NUM_MAP_LOCATIONS;
-    int numHunt, minNumHunt = NUM_HUNTERS;
-    int numPossHunt, minNumPossHunt = NUM_HUNTERS;
-    int possHunt, minPossHunt = NUM_HUNTERS;
-    int locScore, maxScore = -1000;
-    LocationID currLoc, nextLoc;
-    LocationID tmpHideTrail[TRAIL_SIZE];
-    LocationID tmpTrail[TRAIL_SIZE];
-    char *locAbbrev = malloc(3 * sizeof(char));
-    int i, hideAllow, count = 0;
-    int *hideArray = calloc(numLoc, sizeof(int));
-    
-    for (i = 0; i < numLoc; i++) {
-        idToAbbrev(adjLoc[i], locAbbrev);
-        copyArray(trail, tmpTrail, TRAIL_SIZE);
-        copyArray(hideTrail, tmpHideTrail, TRAIL_SIZE);
-        locToDBOrHI(locAbbrev, adjLoc[i], tmpTrail, tmpHideTrail);
-        if (tmpHideTrail[0] > MAX_MAP_LOCATION) {
-            count++;
-            hideArray[i] = 1;
-        }
-    }
-    free(locAbbrev);
-    if (count >= numLoc - 1) hideAllow = 1;
-    else hideAllow = 0;
-    
-    for (i = 0; i < numLoc; i++) {
-        numHunt = numOfHunter(adjLoc[i], hTrail);
-        numPossHunt = numOfPossHunter(gameState, map, railMap, adjLoc[i], knownLoc,
-                                      knownNumLoc, currRound, trail, hTrail, hHealth, path);
-        possHunt = possibleHunters(gameState, adjLoc[i], currRound, hTrail);
-        tmpTrail[0] = adjLoc[i];
-        tmpHideTrail[0] = adjLoc[i];
-        length = dracPathLength(map, adjLoc[i], SARAGOSSA, tmpTrail, tmpHideTrail, &nextLoc, hideAllow);
-        locScore = locationScore(map, adjLoc[i], health, currRound);
-        if (hideArray[i] == 1) locScore -= 50;
-        //printf("adjLoc= =%s, numHunt = %d, numPossHunt = %d, possHunt = %d, length = %d, locScore = %d, maxScore = %d\n", idToName(adjLoc[x]), numHunt, numPossHunt, possHunt, length, locScore, maxScore);
-        //printf("minPossHunt = %d, minNumPossHunt = %d, minNumHunt = %d, minLength = %d, maxScore = %d\n", minPossHunt, minNumPossHunt, minNumHunt, *minLength, maxScore);
-        if (isBestLoc(adjLoc[i], possHunt, &minPossHunt, numPossHunt,
-                      &minNumPossHunt, numHunt, &minNumHunt, length,
-                      &minLength, locScore, &maxScore))
-            currLoc = adjLoc[i];
-    }
-    //printf("currLoc is %d\n", currLoc);
-    free(hideArray);
-    return currLoc;
+    return escapeTowards(gameState, map, railMap, adjLoc, numLoc, SARAGOSSA, 50, currRound, knownLoc,
+                         knownNumLoc, health, hTrail, hHealth, trail, hideTrail, path);
 }
 
 // find the shortest path to escape to bottom area and return the next location in that path
@@ -1688,50 +1596,8 @@ LocationID escapeToBottom(DracView gameState, Map map, Map railMap, LocationID *
                         Round currRound, int *knownLoc, int knownNumLoc, int distCurrFromHunt,
                         int health, LocationID hTrail[NUM_HUNTERS][TRAIL_SIZE], int hHealth[NUM_HUNTERS],
                         LocationID trail[TRAIL_SIZE], LocationID hideTrail[TRAIL_SIZE], LocationID *path) {
-    int length, minLength = NUM_MAP_LOCATIONS;
-    int numHunt, minNumHunt = NUM_HUNTERS;
-    int numPossHunt, minNumPossHunt = NUM_HUNTERS;
-    int possHunt, minPossHunt = NUM_HUNTERS;
-    int locScore, maxScore = -1000;
-    LocationID currLoc, nextLoc;
-    LocationID tmpHideTrail[TRAIL_SIZE];
-    LocationID tmpTrail[TRAIL_SIZE];
-    char *locAbbrev = malloc(3 * sizeof(char));
-    int i, hideAllow, count = 0;
-    int *hideArray = calloc(numLoc, sizeof(int));
-    
-    for (i = 0; i < numLoc; i++) {
-        idToAbbrev(adjLoc[i], locAbbrev);
-        copyArray(trail, tmpTrail, TRAIL_SIZE);
-        copyArray(hideTrail, tmpHideTrail, TRAIL_SIZE);
-        locToDBOrHI(locAbbrev, adjLoc[i], tmpTrail, tmpHideTrail);
-        if (tmpHideTrail[0] > MAX_MAP_LOCATION) {
-            count++;
-            hideArray[i] = 1;
-        }
-    }
-    free(locAbbrev);
-    if (count >= numLoc - 1) hideAllow = 1;
-    else hideAllow = 0;
-    
-    for (i = 0; i < numLoc; i++) {
-        numHunt = numOfHunter(adjLoc[i], hTrail);
-        numPossHunt = numOfPossHunter(gameState, map, railMap, adjLoc[i], knownLoc,
-                                      knownNumLoc, currRound, trail, hTrail, hHealth, path);
-        possHunt = possibleHunters(gameState, adjLoc[i], currRound, hTrail);
-        tmpTrail[0] = adjLoc[i];
-        tmpHideTrail[0] = adjLoc[i];
-        length = dracPathLength(map, adjLoc[i], ROME, tmpTrail, tmpHideTrail, &nextLoc, hideAllow);
-        locScore = locationScore(map, adjLoc[i], health, currRound);
-        //printf("adjLoc= =%s, numHunt = %d, numPossHunt = %d, possHunt = %d, length = %d, locScore = %d, maxScore = %d\n", idToName(adjLoc[x]), numHunt, numPossHunt, possHunt, length, locScore, maxScore);
-        //printf("minPossHunt = %d, minNumPossHunt = %d, minNumHunt = %d, minLength = %d, maxScore = %d\n", minPossHunt, minNumPossHunt, minNumHunt, *minLength, maxScore);
-        if (isBestLoc(adjLoc[i], possHunt, &minPossHunt, numPossHunt,
-                      &minNumPossHunt, numHunt, &minNumHunt, length,
-                      &minLength, locScore, &maxScore))
-            currLoc = adjLoc[i];
-    }
-    free(hideArray);
-    return currLoc;
+    return escapeTowards(gameState, map, railMap, adjLoc, numLoc, ROME, 0, currRound, knownLoc,
+                         knownNumLoc, health, hTrail, hHealth, trail, hideTrail, path);
 }
 
 // find the shortest path to escape to top area and return the next location in that path
@@ -1739,50 +1605,8 @@ LocationID escapeToTop(DracView gameState, Map map, Map railMap, LocationID *adj
                         Round currRound, int *knownLoc, int knownNumLoc, int distCurrFromHunt,
                         int health, LocationID hTrail[NUM_HUNTERS][TRAIL_SIZE], int hHealth[NUM_HUNTERS],
                         LocationID trail[TRAIL_SIZE], LocationID hideTrail[TRAIL_SIZE], LocationID *path) {
-    int length, minLength = NUM_MAP_LOCATIONS;
-    int numHunt, minNumHunt = NUM_HUNTERS;
-    int numPossHunt, minNumPossHunt = NUM_HUNTERS;
-    int possHunt, minPossHunt = NUM_HUNTERS;
-    int locScore, maxScore = -1000;
-    LocationID currLoc, nextLoc;
-    LocationID tmpHideTrail[TRAIL_SIZE];
-    LocationID tmpTrail[TRAIL_SIZE];
-    char *locAbbrev = malloc(3 * sizeof(char));
-    int i, hideAllow, count = 0;
-    int *hideArray = calloc(numLoc, sizeof(int));
-    
-    for (i = 0; i < numLoc; i++) {
-        idToAbbrev(adjLoc[i], locAbbrev);
-        copyArray(trail, tmpTrail, TRAIL_SIZE);
-        copyArray(hideTrail, tmpHideTrail, TRAIL_SIZE);
-        locToDBOrHI(locAbbrev, adjLoc[i], tmpTrail, tmpHideTrail);
-        if (tmpHideTrail[0] > MAX_MAP_LOCATION) {
-            count++;
-            hideArray[i] = 1;
-        }
-    }
-    free(locAbbrev);
-    if (count >= numLoc - 1) hideAllow = 1;
-    else hideAllow = 0;
-    
-    for (i = 0; i < numLoc; i++) {
-        numHunt = numOfHunter(adjLoc[i], hTrail);
-        numPossHunt = numOfPossHunter(gameState, map, railMap, adjLoc[i], knownLoc,
-                                      knownNumLoc, currRound, trail, hTrail, hHealth, path);
-        possHunt = possibleHunters(gameState, adjLoc[i], currRound, hTrail);
-        tmpTrail[0] = adjLoc[i];
-        tmpHideTrail[0] = adjLoc[i];
-        length = dracPathLength(map, adjLoc[i], LONDON, tmpTrail, tmpHideTrail, &nextLoc, hideAllow);
-        locScore = locationScore(map, adjLoc[i], health, currRound);
-        //printf("adjLoc= =%s, numHunt = %d, numPossHunt = %d, possHunt = %d, length = %d, locScore = %d, maxScore = %d\n", idToName(adjLoc[x]), numHunt, numPossHunt, possHunt, length, locScore, maxScore);
-        //printf("minPossHunt = %d, minNumPossHunt = %d, minNumHunt = %d, minLength = %d, maxScore = %d\n", minPossHunt, minNumPossHunt, minNumHunt, *minLength, maxScore);
-        if (isBestLoc(adjLoc[i], possHunt, &minPossHunt, numPossHunt,
-                      &minNumPossHunt, numHunt, &minNumHunt, length,
-                      &minLength, locScore, &maxScore))
-            currLoc = adjLoc[i];
-    }
-    free(hideArray);
-    return currLoc;
+    return escapeTowards(gameState, map, railMap, adjLoc, numLoc, LONDON, 0, currRound, knownLoc,
+                         knownNumLoc, health, hTrail, hHealth, trail, hideTrail, path);
 }
 
 // find the shortest path to escape to middle area and return the next location in that path
@@ -1790,50 +1614,8 @@ LocationID escapeToMiddle(DracView gameState, Map map, Map railMap, LocationID *
                         Round currRound, int *knownLoc, int knownNumLoc, int distCurrFromHunt,
                         int health, LocationID hTrail[NUM_HUNTERS][TRAIL_SIZE], int hHealth[NUM_HUNTERS],
                         LocationID trail[TRAIL_SIZE], LocationID hideTrail[TRAIL_SIZE], LocationID *path) {
-    int length, minLength = NUM_MAP_LOCATIONS;
-    int numHunt, minNumHunt = NUM_HUNTERS;
-    int numPossHunt, minNumPossHunt = NUM_HUNTERS;
-    int possHunt, minPossHunt = NUM_HUNTERS;
-    int locScore, maxScore = -1000;
-    LocationID currLoc, nextLoc;
-    LocationID tmpHideTrail[TRAIL_SIZE];
-    LocationID tmpTrail[TRAIL_SIZE];
-    char *locAbbrev = malloc(3 * sizeof(char));
-    int i, hideAllow, count = 0;
-    int *hideArray = calloc(numLoc, sizeof(int));
-    
-    for (i = 0; i < numLoc; i++) {
-        idToAbbrev(adjLoc[i], locAbbrev);
-        copyArray(trail, tmpTrail, TRAIL_SIZE);
-        copyArray(hideTrail, tmpHideTrail, TRAIL_SIZE);
-        locToDBOrHI(locAbbrev, adjLoc[i], tmpTrail, tmpHideTrail);
-        if (tmpHideTrail[0] > MAX_MAP_LOCATION) {
-            count++;
-            hideArray[i] = 1;
-        }
-    }
-    free(locAbbrev);
-    if (count >= numLoc - 1) hideAllow = 1;
-    else hideAllow = 0;
-    
-    for (i = 0; i < numLoc; i++) {
-        numHunt = numOfHunter(adjLoc[i], hTrail);
-        numPossHunt = numOfPossHunter(gameState, map, railMap, adjLoc[i], knownLoc,
-                                      knownNumLoc, currRound, trail, hTrail, hHealth, path);
-        possHunt = possibleHunters(gameState, adjLoc[i], currRound, hTrail);
-        tmpTrail[0] = adjLoc[i];
-        tmpHideTrail[0] = adjLoc[i];
-        length = dracPathLength(map, adjLoc[i], ZURICH, tmpTrail, tmpHideTrail, &nextLoc, hideAllow);
-        locScore = locationScore(map, adjLoc[i], health, currRound);
-        //printf("adjLoc= =%s, numHunt = %d, numPossHunt = %d, possHunt = %d, length = %d, locScore = %d, maxScore = %d\n", idToName(adjLoc[x]), numHunt, numPossHunt, possHunt, length, locScore, maxScore);
-        //printf("minPossHunt = %d, minNumPossHunt = %d, minNumHunt = %d, minLength = %d, maxScore = %d\n", minPossHunt, minNumPossHunt, minNumHunt, *minLength, maxScore);
-        if (isBestLoc(adjLoc[i], possHunt, &minPossHunt, numPossHunt,
-                      &minNumPossHunt, numHunt, &minNumHunt, length,
-                      &minLength, locScore, &maxScore))
-            currLoc = adjLoc[i];
-    }
-    free(hideArray);
-    return currLoc;
+    return escapeTowards(gameState, map, railMap, adjLoc, numLoc, ZURICH, 0, currRound, knownLoc,
+                         knownNumLoc, health, hTrail, hHealth, trail, hideTrail, path);
 }
 
 // determine whether dracula should stay in or leave CD
@@ -1938,7 +1720,7 @@ int isConcerned(Map map, Map railMap, LocationID dCurrLoc, LocationID hTrail[NUM
     if (knownNumLoc == 0) return 0;
     for (hunter = PLAYER_LORD_GODALMING; hunter < NUM_HUNTERS; hunter++) {
 //printf("hunter=%d, from %s, currRound=%d\n", hunter, idToName(hTrail[hunter][0]), currRound);
-        if (hunterPathLength(map, railMap, hTrail[hunter][0], dCurrLoc, hunter, currRound+1, path) <= 2)
+        if (shortestDistance(hTrail[hunter][0], dCurrLoc, hunter, currRound+1, BY_ANY) <= 2)
             count++;
     }
     if (count >= 3) return 1;
@@ -1967,7 +1749,7 @@ LocationID stayInSea(DracView gameState, Map map, Map railMap, LocationID *adjLo
     if (idToType(trail[0]) == SEA) {
         int needHiding, adjNumLoc, nAdjSea = 0;
         char *locAbbrev = malloc(3 * sizeof(char));
-        LocationID *nextAdjLoc;
+        LocationID nextAdjLoc[NUM_MAP_LOCATIONS];
         int i, j, count;
         int shouldTP = shouldTeleport(map, railMap, hTrail, currRound, path);
         
@@ -1977,8 +1759,8 @@ LocationID stayInSea(DracView gameState, Map map, Map railMap, LocationID *adjLo
             copyArray(trail, tmpTrail, TRAIL_SIZE);
             copyArray(hideTrail, tmpHideTrail, TRAIL_SIZE);
             locToDBOrHI(locAbbrev, adjLoc[i], tmpTrail, tmpHideTrail);
-            nextAdjLoc = whereCanIgo(&adjNumLoc, tmpTrail,
-                                     tmpHideTrail, adjLoc[i], TRUE, TRUE);
+            adjNumLoc = fillWhereCanIgo(nextAdjLoc, tmpTrail,
+                                        tmpHideTrail, adjLoc[i], TRUE, TRUE);
             if (tmpHideTrail[0] > MAX_MAP_LOCATION) needHiding = 1;
             else needHiding = 0;
             count = 0;
@@ -2127,7 +1909,7 @@ LocationID stayInSea(DracView gameState, Map map, Map railMap, LocationID *adjLo
  //printf ("fur adjLocations[%d] = %s\n", x, idToName(adjLocations[x]));
  possHunters = possibleHunters(gameState, adjLocations[x], round, hTrail);
  for (hunter = PLAYER_LORD_GODALMING; hunter <= PLAYER_MINA_HARKER; hunter++) {
- length = hunterPathLength(map, railMap, hTrail[hunter][0], adjLocations[x], hunter, round+1, path);
+ length = shortestDistance(hTrail[hunter][0], adjLocations[x], hunter, round+1, BY_ANY);
  //printf("src = %s, dest = %s, round = %d, player = %d, length = %d\n", idToName(adjLocations[x]), idToName(whereIs(gameState, hunter)), round, hunter, length);
  if (length < nearestLength) nearestLength = length;
  }
@@ -2159,3 +1941,384 @@ LocationID stayInSea(DracView gameState, Map map, Map railMap, LocationID *adjLo
  //idToAbbrev(location, abbrev);
  return location;
  }*/
+
+/////////////////////////////////////////////////////////
+// Lookahead search
+//
+// The one move lookahead above only scores where Dracula goes next.
+// searchBestMove() runs it first, so there is always a move registered,
+// and then uses whatever time is left on an expectimax search: Dracula
+// picks his best move, each hunter either chases him along a shortest
+// route or stays put, and the position at the end is scored with
+// moveScore() (which is built on optimalLocScore() and locationScore()).
+// The search goes one Dracula move deeper each time and the best move of
+// every finished depth is registered, so stopping at any point still
+// leaves the deepest answer found. Positions are hashed as they are
+// played out and their values kept in a transposition table, so a
+// position reached again isn't searched twice.
+//
+// Each of Dracula's first moves is searched on its own, so the first moves
+// of a depth are shared out between a few threads. Every thread has its
+// own copy of the position, its own table and its own scratch path, and
+// starts each first move with an empty table, so a move's value is the
+// same whichever thread searched it and the move chosen doesn't depend on
+// how many threads there are. The threads are started for each depth and
+// joined before its best move is registered.
+
+// how long the search may run, in milliseconds (depth 1 always finishes)
+#ifndef DRAC_SEARCH_TIME_MS
+#define DRAC_SEARCH_TIME_MS     800
+#endif
+
+// how many threads search, 0 for one per core
+#ifndef DRAC_SEARCH_THREADS
+#define DRAC_SEARCH_THREADS     0
+#endif
+
+#define MAX_SEARCH_DEPTH        6      // Dracula moves looked ahead at most
+#define HUNTER_CHASE_CHANCE     0.75   // chance a hunter heads for Dracula
+#define LEAF_HEALTH_WEIGHT      4      // score for each blood point left
+#define LOST_SCORE              -100000
+#define SEARCH_TABLE_SIZE       14     // log2 of the buckets (64 bytes each)
+
+typedef struct rootSearch RootSearch;
+
+// what one search thread works on, none of it shared with the others
+typedef struct searchWorker {
+    RootSearch *search;
+    pthread_t thread;
+    GameState state;                       // its own copy of the position
+    TransTable table;
+    LocationID path[NUM_MAP_LOCATIONS];    // scratch for the distance functions
+} SearchWorker;
+
+// one depth of the search, shared by the threads
+struct rootSearch {
+    DracView gameState;
+    Map map;
+    Map railMap;
+    LocationID *adjLoc;                    // Dracula's first moves
+    int numLoc;
+    int depth;
+    int distAdjust;
+    int next;                              // the next first move to hand out
+    pthread_mutex_t lock;                  // guards next
+    double value[NUM_MAP_LOCATIONS];       // what each first move is worth
+};
+
+static int searchTime = DRAC_SEARCH_TIME_MS;
+static int searchThreads = DRAC_SEARCH_THREADS;
+static struct timespec searchStart;
+static atomic_int timeIsUp;
+
+void setDraculaSearchTime(int milliseconds) {
+    assert(milliseconds >= 0);
+    searchTime = milliseconds;
+}
+
+void setDraculaSearchThreads(int threads) {
+    assert(threads >= 0);
+    searchThreads = threads;
+}
+
+// milliseconds since the search started
+static long searchElapsed(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - searchStart.tv_sec) * 1000 +
+           (now.tv_nsec - searchStart.tv_nsec) / 1000000;
+}
+
+// check the clock, remembering once the time has run out
+static int outOfTime(void) {
+    if (!timeIsUp && searchElapsed() >= searchTime) timeIsUp = 1;
+    return timeIsUp;
+}
+
+// register best as the move, turned into a hide or double back if need be
+static void registerMove(LocationID best, LocationID trail[TRAIL_SIZE],
+                         LocationID hideTrail[TRAIL_SIZE], const char *msg) {
+    LocationID tmpTrail[TRAIL_SIZE];
+    LocationID tmpHideTrail[TRAIL_SIZE];
+    PlayerMessage message;
+    char locAbbrev[3];
+    
+    copyArray(trail, tmpTrail, TRAIL_SIZE);
+    copyArray(hideTrail, tmpHideTrail, TRAIL_SIZE);
+    idToAbbrev(best, locAbbrev);
+    locToDBOrHI(locAbbrev, best, tmpTrail, tmpHideTrail);
+    // the engine takes a whole PlayerMessage
+    strncpy(message, msg, MESSAGE_SIZE - 1);
+    message[MESSAGE_SIZE - 1] = '\0';
+    registerBestPlay(locAbbrev, message);
+}
+
+// where Dracula can go in state
+static int searchMoves(GameState *state, LocationID moves[NUM_MAP_LOCATIONS]) {
+    LocationID trail[TRAIL_SIZE];
+    LocationID hideTrail[TRAIL_SIZE];
+    
+    stateTrail(state, trail, hideTrail);
+    return fillWhereCanIgo(moves, trail, hideTrail, trail[0], TRUE, TRUE);
+}
+
+// Dracula moves to dest in state, as a hide or double back if need be
+static void playDracMove(GameState *state, LocationID dest, MoveUndo *undo) {
+    LocationID trail[TRAIL_SIZE];
+    LocationID hideTrail[TRAIL_SIZE];
+    char locAbbrev[3];
+    
+    stateTrail(state, trail, hideTrail);
+    idToAbbrev(dest, locAbbrev);
+    locToDBOrHI(locAbbrev, dest, trail, hideTrail);
+    applyMove(state, hideTrail[0], undo);
+}
+
+// score the position at the end of a line of play, where Dracula has
+//  just chosen dest in the worker's state
+static double leafScore(RootSearch *s, SearchWorker *w, LocationID dest) {
+    GameState *state = &w->state;
+    LocationID trail[TRAIL_SIZE];
+    LocationID hideTrail[TRAIL_SIZE];
+    LocationID hTrail[NUM_HUNTERS][TRAIL_SIZE];
+    PlayerID hunter;
+    MoveUndo undo;
+    int score, health;
+    
+    stateTrail(state, trail, hideTrail);
+    for (hunter = PLAYER_LORD_GODALMING; hunter < NUM_HUNTERS; hunter++) {
+        initialiseTrail(hTrail[hunter]);
+        hTrail[hunter][0] = state->location[hunter];
+    }
+    // the hunters don't know where the searched moves went, so nothing is known
+    score = moveScore(s->gameState, s->map, s->railMap, dest, state->round, NULL, 0,
+                      state->health[PLAYER_DRACULA], s->distAdjust, hTrail, NULL,
+                      trail, hideTrail, w->path);
+    playDracMove(state, dest, &undo);
+    health = state->health[PLAYER_DRACULA];
+    undoMove(state, &undo);
+    if (health <= 0) return LOST_SCORE;
+    return score + LEAF_HEALTH_WEIGHT * health;
+}
+
+static double hunterValue(RootSearch *s, SearchWorker *w, int depth);
+
+// the best Dracula can expect from the worker's state with depth more moves to make
+static double dracValue(RootSearch *s, SearchWorker *w, int depth) {
+    GameState *state = &w->state;
+    LocationID moves[NUM_MAP_LOCATIONS];
+    HashKey key = state->hash;
+    MoveUndo undo;
+    double value, best = LOST_SCORE;
+    int numMoves, i;
+    
+    if (outOfTime()) return 0;
+    if (probeTransTable(w->table, key, depth, &value)) return value;
+    numMoves = searchMoves(state, moves);
+    // with nowhere to go Dracula is teleported to his castle
+    if (numMoves == 0) moves[numMoves++] = CASTLE_DRACULA;
+    for (i = 0; i < numMoves && !timeIsUp; i++) {
+        if (depth == 1) {
+            value = leafScore(s, w, moves[i]);
+        } else {
+            playDracMove(state, moves[i], &undo);
+            if (state->health[PLAYER_DRACULA] <= 0) value = LOST_SCORE;
+            else value = hunterValue(s, w, depth - 1);
+            undoMove(state, &undo);
+        }
+        if (value > best) best = value;
+    }
+    if (!timeIsUp) storeTransTable(w->table, key, depth, best);
+    return best;
+}
+
+// the hunters' replies to Dracula's last move, weighted by how likely each is
+// every hunter chases Dracula (one step along a shortest route) or stays put
+static double hunterValue(RootSearch *s, SearchWorker *w, int depth) {
+    GameState *state = &w->state;
+    LocationID dracLoc = state->location[PLAYER_DRACULA];
+    LocationID from[NUM_HUNTERS], chase[NUM_HUNTERS];
+    MoveUndo undo[NUM_HUNTERS];
+    PlayerID hunter;
+    double chance, value = 0;
+    int choice, lost;
+    
+    for (hunter = PLAYER_LORD_GODALMING; hunter < NUM_HUNTERS; hunter++) {
+        from[hunter] = state->location[hunter];
+        chase[hunter] = shortestNextMove(from[hunter], dracLoc, hunter, state->round, BY_ANY);
+    }
+    // bit "hunter" of choice is set if that hunter chases Dracula
+    for (choice = 0; choice < (1 << NUM_HUNTERS) && !timeIsUp; choice++) {
+        chance = 1;
+        for (hunter = PLAYER_LORD_GODALMING; hunter < NUM_HUNTERS; hunter++) {
+            // a hunter staying put either way is counted only once
+            if (chase[hunter] == from[hunter] && (choice & (1 << hunter))) break;
+            if (chase[hunter] != from[hunter]) {
+                if (choice & (1 << hunter)) chance *= HUNTER_CHASE_CHANCE;
+                else chance *= 1 - HUNTER_CHASE_CHANCE;
+            }
+        }
+        if (hunter < NUM_HUNTERS) continue;
+        for (hunter = PLAYER_LORD_GODALMING; hunter < NUM_HUNTERS; hunter++) {
+            applyMove(state, (choice & (1 << hunter)) ? chase[hunter] : from[hunter], &undo[hunter]);
+        }
+        lost = (state->health[PLAYER_DRACULA] <= 0);
+        value += chance * (lost ? LOST_SCORE : dracValue(s, w, depth));
+        for (hunter = NUM_HUNTERS - 1; hunter >= PLAYER_LORD_GODALMING; hunter--) {
+            undoMove(state, &undo[hunter]);
+        }
+    }
+    return value;
+}
+
+// a search thread, taking first moves to search until there are none left
+static void *searchFirstMoves(void *arg) {
+    SearchWorker *w = arg;
+    RootSearch *s = w->search;
+    MoveUndo undo;
+    int i;
+    
+    while (!timeIsUp) {
+        pthread_mutex_lock(&s->lock);
+        i = s->next++;
+        pthread_mutex_unlock(&s->lock);
+        if (i >= s->numLoc) break;
+        
+        // what was searched before mustn't change what this move is worth
+        clearTransTable(w->table);
+        playDracMove(&w->state, s->adjLoc[i], &undo);
+        if (w->state.health[PLAYER_DRACULA] <= 0) s->value[i] = LOST_SCORE;
+        else s->value[i] = hunterValue(s, w, s->depth - 1);
+        undoMove(&w->state, &undo);
+    }
+    return NULL;
+}
+
+// search every first move depth deep, filling in s->value
+static void searchDepth(RootSearch *s, SearchWorker *workers, int numWorkers, int depth) {
+    int i, err;
+    
+    s->depth = depth;
+    s->next = 0;
+    if (numWorkers == 1) {
+        searchFirstMoves(&workers[0]);
+        return;
+    }
+    for (i = 0; i < numWorkers; i++) {
+        err = pthread_create(&workers[i].thread, NULL, searchFirstMoves, &workers[i]);
+        assert(err == 0);
+    }
+    for (i = 0; i < numWorkers; i++) {
+        err = pthread_join(workers[i].thread, NULL);
+        assert(err == 0);
+    }
+}
+
+int moveScore(DracView gameState, Map map, Map railMap, LocationID dest, Round currRound,
+              int *knownLoc, int knownNumLoc, int health, int distAdjust,
+              LocationID hTrail[NUM_HUNTERS][TRAIL_SIZE], int hHealth[NUM_HUNTERS],
+              LocationID trail[TRAIL_SIZE], LocationID hideTrail[TRAIL_SIZE], LocationID *path) {
+    LocationID tmpTrail[TRAIL_SIZE];
+    LocationID tmpHideTrail[TRAIL_SIZE];
+    int needHiding, numPossHunt = 0;
+    
+    // the trail as it is once Dracula has moved, with the move not yet hidden
+    copyArray(trail, tmpTrail, TRAIL_SIZE);
+    copyArray(hideTrail, tmpHideTrail, TRAIL_SIZE);
+    shiftRight(tmpTrail, 0, TRAIL_SIZE - 1);
+    shiftRight(tmpHideTrail, 0, TRAIL_SIZE - 1);
+    tmpTrail[0] = dest;
+    tmpHideTrail[0] = dest;
+    
+    int distFromHunt = distFromNearestHunter(map, railMap, dest, path, currRound, hTrail);
+    int distFromSea = distFromNearestSea(map, dest, tmpTrail, tmpHideTrail);
+    int nNextAdj = numOfNextAdj(dest, trail, hideTrail, &needHiding);
+    int possHunt = possibleHunters(gameState, dest, currRound, hTrail);
+    int numHunt = numOfHunter(dest, hTrail);
+    if (knownNumLoc > 0) {
+        numPossHunt = numOfPossHunter(gameState, map, railMap, dest, knownLoc,
+                                      knownNumLoc, currRound, trail, hTrail, hHealth, path);
+    }
+    int locScore = locationScore(map, dest, health, currRound);
+    int tuneScore = scoreTunner(dest, numHunt, possHunt, needHiding,
+                                knownLoc, knownNumLoc, distFromHunt, trail);
+    return optimalLocScore(distFromHunt, nNextAdj, possHunt, numHunt,
+                           numPossHunt, locScore, tuneScore, distFromSea, distAdjust);
+}
+
+LocationID searchBestMove(DracView gameState, Map map, Map railMap, LocationID *adjLoc, int numLoc,
+                          Round currRound, int *knownLoc, int knownNumLoc, int health, int distAdjust,
+                          LocationID hTrail[NUM_HUNTERS][TRAIL_SIZE], int hHealth[NUM_HUNTERS],
+                          LocationID trail[TRAIL_SIZE], LocationID hideTrail[TRAIL_SIZE], LocationID *path) {
+    RootSearch search;
+    SearchWorker *workers;
+    GameState root;
+    LocationID best = adjLoc[0], depthBest;
+    double bestValue;
+    int optimalScore, maxOptimalScore = -1000;
+    int numWorkers, depth, i;
+    
+    clock_gettime(CLOCK_MONOTONIC, &searchStart);
+    timeIsUp = 0;
+    
+    // depth 1 is the one move lookahead, which always runs to the end
+    for (i = 0; i < numLoc; i++) {
+        optimalScore = moveScore(gameState, map, railMap, adjLoc[i], currRound,
+                                 knownLoc, knownNumLoc, health, distAdjust,
+                                 hTrail, hHealth, trail, hideTrail, path);
+        if (optimalScore > maxOptimalScore) {
+            maxOptimalScore = optimalScore;
+            best = adjLoc[i];
+        }
+    }
+    registerMove(best, trail, hideTrail, "other moves");
+    if (numLoc < 2) return best;
+    
+    // the tables that are otherwise built the first time they are used
+    //  can't be built by several threads at once
+    buildDistances();
+    buildPlaceTables();
+    dracViewToState(gameState, &root);
+    
+    numWorkers = searchThreads;
+    if (numWorkers == 0) numWorkers = sysconf(_SC_NPROCESSORS_ONLN);
+    if (numWorkers > numLoc) numWorkers = numLoc;
+    if (numWorkers < 1) numWorkers = 1;
+    
+    search.gameState = gameState;
+    search.map = map;
+    search.railMap = railMap;
+    search.adjLoc = adjLoc;
+    search.numLoc = numLoc;
+    search.distAdjust = distAdjust;
+    pthread_mutex_init(&search.lock, NULL);
+    workers = malloc(numWorkers * sizeof(SearchWorker));
+    assert(workers != NULL);
+    for (i = 0; i < numWorkers; i++) {
+        workers[i].search = &search;
+        workers[i].state = root;
+        workers[i].table = newTransTable(SEARCH_TABLE_SIZE);
+    }
+    
+    for (depth = 2; depth <= MAX_SEARCH_DEPTH && !outOfTime(); depth++) {
+        searchDepth(&search, workers, numWorkers, depth);
+        // a depth cut short by the clock is thrown away
+        if (timeIsUp) break;
+        // the first of equally good moves wins, as in the one move lookahead
+        depthBest = adjLoc[0];
+        bestValue = LOST_SCORE - 1;
+        for (i = 0; i < numLoc; i++) {
+            if (search.value[i] > bestValue) {
+                bestValue = search.value[i];
+                depthBest = adjLoc[i];
+            }
+        }
+        best = depthBest;
+        registerMove(best, trail, hideTrail, "other moves");
+    }
+    
+    for (i = 0; i < numWorkers; i++) disposeTransTable(workers[i].table);
+    free(workers);
+    pthread_mutex_destroy(&search.lock);
+    return best;
+}
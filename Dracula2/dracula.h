@@ -5,3 +5,14 @@
 // Version: 1.0
 
 void decideDraculaMove(DracView gameState);
+
+// forget everything kept from an earlier game (the book, see DracBook.h)
+void newDraculaGame(void);
+
+// how long decideDraculaMove() may spend searching, in milliseconds
+// (the real player.c stops it at its own time limit either way)
+void setDraculaSearchTime(int milliseconds);
+
+// how many threads decideDraculaMove() searches with, 0 for one per core
+// (the move chosen doesn't depend on it, only how deep the search gets)
+void setDraculaSearchThreads(int threads);
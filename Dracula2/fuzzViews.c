@@ -0,0 +1,907 @@
+// fuzzViews.c ... randomised checks of the views against a slow reference
+//
+// Games of random legal moves are played (see RandomGame.h, some of the
+// moves are wild ones so the games have plenty of encounters, deaths and
+// teleports in them) and after every few turns a view is built from the
+// plays so far and its answers are checked against
+//   the GameState the game was played on (round, score, health, where
+//     everyone is, Dracula's trail and what he left there),
+//   the play string itself (what each player's history should show),
+//   a view of the same game that was built a play at a time instead,
+//   and slow reference versions of connectedLocations() and the path
+//     functions, written as plainly as possible over the map's edge lists:
+//     every legal move is worked out afresh, and distances by a breadth
+//     first search over whole turns,
+//   and (for Dracula) dracDistance() and dracReachable() against a
+//     breadth first search over every trail he can have in a few moves,
+//     without the pruning DracReach does.
+// Any difference is reported with the seed, wildness and turn, which are
+// all it takes to make the same game again.
+//
+// The time and the number of mallocs of each call of connectedLocations(),
+// fillConnectedLocations() and the path functions are recorded for every
+// state checked. The slowest states for each are listed at the end, and
+// with -o every state's costs are written to a file, one line a function:
+//   seed turn function calls nanoseconds mallocs
+// (mallocs are counted by wrapping malloc() at link time, see the
+// Makefile; with TRACE=1 the trace code does that instead and they show
+// up as -1 here).
+//
+// Like benchViews.c this is built twice: with -DI_AM_DRACULA it checks
+// DracView and Dracula's GameView, otherwise HunterView and the hunters'.
+//
+// usage: ./fuzzHunterView [-n games] [-s seed] [-w wild percent]
+//                         [-k stride] [-t slowest] [-o costs file]
+// The exit status is 1 if anything didn't match.
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "Game.h"
+#include "Globals.h"
+#include "Places.h"
+#include "Map.h"
+#include "GameView.h"
+#include "GameState.h"
+#include "Distances.h"
+#include "DracReach.h"
+#include "LocSet.h"
+#include "RandomGame.h"
+#include "commonFunctions.h"
+#ifdef I_AM_DRACULA
+#include "DracView.h"
+#else
+#include "HunterView.h"
+#endif
+
+#define MAX_FAILURES       20     // stop after this many differences
+#define PATH_CHECKS        3      // routes checked for each player at each state
+#define MAX_SLOWEST        32
+#define NUM_MASKS          8      // road, rail and sea each on or off
+
+// the functions whose cost is recorded
+#define COST_CONNECTED     0
+#define COST_FILL          1
+#define COST_DISTANCE      2
+#define COST_PATH          3
+#define COST_ROUTE         4
+#define NUM_COSTS          5
+
+static const char *costNames[NUM_COSTS] = {
+    "connectedLocations", "fillConnectedLocations", "shortestDistance",
+    "findPathLength", "hunterRoute"
+};
+
+// what one function cost at one state
+typedef struct cost {
+    int seed;
+    int turn;
+    long calls;
+    double ns;
+    long mallocs;
+} Cost;
+
+static PlayerMessage messages[MAX_TURNS];
+static FILE *out;                         // where the results go (see main)
+static FILE *costFile;                    // -o, or NULL
+static Map graph;                         // read only through its edge lists
+static int failures;
+static int numSlowest = 5;
+static unsigned int checkSeed = 1;        // for the checks, so the games don't depend on them
+#ifndef I_AM_DRACULA
+static char grownPlays[MAX_PLAYS_SIZE];   // the plays the grown view was given
+static char batch[MAX_PLAYS_SIZE + 2];    // some of the plays, with spaces around them
+#endif
+
+// the game being checked, for the reports
+static int gameSeed, gameWild, gameTurn;
+
+// the cost of each function at the current state, and the totals
+static Cost now[NUM_COSTS];
+static Cost total[NUM_COSTS];
+static Cost slowest[NUM_COSTS][MAX_SLOWEST];
+static int numKept[NUM_COSTS];
+
+
+//// Counting mallocs
+
+#ifndef TRACE
+
+static long mallocs;
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t n, size_t size);
+void *__real_realloc(void *p, size_t size);
+void __real_free(void *p);
+
+void *__wrap_malloc(size_t size) {
+    mallocs++;
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t n, size_t size) {
+    mallocs++;
+    return __real_calloc(n, size);
+}
+
+void *__wrap_realloc(void *p, size_t size) {
+    if (p == NULL) mallocs++;
+    return __real_realloc(p, size);
+}
+
+void __wrap_free(void *p) {
+    __real_free(p);
+}
+
+#define MALLOCS          mallocs
+#define MALLOCS_COUNTED  TRUE
+
+#else
+
+#define MALLOCS          0L
+#define MALLOCS_COUNTED  FALSE
+
+#endif
+
+static double clockNs(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+// record the cost of the code after f, one call of that function
+#define COST(f, ...) do {                            \
+        long m_ = MALLOCS;                           \
+        double start_ = clockNs();                   \
+        __VA_ARGS__;                                 \
+        now[f].ns += clockNs() - start_;             \
+        now[f].mallocs += MALLOCS - m_;              \
+        now[f].calls++;                              \
+    } while (0)
+
+
+//// Reporting differences
+
+static void fail(const char *format, ...) {
+    va_list args;
+
+    failures++;
+    if (failures > MAX_FAILURES) return;
+    fprintf(out, "seed %d wild %d turn %d: ", gameSeed, gameWild, gameTurn);
+    va_start(args, format);
+    vfprintf(out, format, args);
+    va_end(args);
+    fprintf(out, "\n");
+}
+
+#define EXPECT(what, got, want) do {                                 \
+        long got_ = (got), want_ = (want);                           \
+        if (got_ != want_) fail("%s is %ld, should be %ld", what, got_, want_); \
+    } while (0)
+
+
+//// The slow reference
+
+// 1 for every place player can get to in one move from "from"
+static void refMoves(int reach[NUM_MAP_LOCATIONS], LocationID from, PlayerID player,
+                     Round round, int road, int rail, int sea) {
+    LocationID stations[NUM_MAP_LOCATIONS], to;
+    int onLine[NUM_MAP_LOCATIONS] = {0};
+    TransportID type;
+    EdgeIter it;
+    int numStations = 0, first, last, hop, hops, i;
+
+    memset(reach, 0, NUM_MAP_LOCATIONS * sizeof(int));
+    reach[from] = 1;
+    for (startEdges(graph, from, &it); nextEdge(&it, &to, &type); ) {
+        if ((type == ROAD && road) || (type == BOAT && sea)) reach[to] = 1;
+    }
+    if (rail && player != PLAYER_DRACULA) {
+        // stop by stop along the line, up to (round + player) % 4 stops
+        hops = (round + player) % 4;
+        stations[numStations++] = from;
+        onLine[from] = 1;
+        for (first = 0, hop = 0; hop < hops; hop++) {
+            last = numStations;
+            for (i = first; i < last; i++) {
+                for (startEdges(graph, stations[i], &it); nextEdge(&it, &to, &type); ) {
+                    if (type != RAIL || onLine[to]) continue;
+                    onLine[to] = 1;
+                    reach[to] = 1;
+                    stations[numStations++] = to;
+                }
+            }
+            first = last;
+        }
+    }
+    if (player == PLAYER_DRACULA) reach[ST_JOSEPH_AND_ST_MARYS] = 0;
+}
+
+// fewest turns from src to dest, trying every move every turn
+static int refDistance(LocationID src, LocationID dest, PlayerID player,
+                       Round round, int transport) {
+    int at[NUM_MAP_LOCATIONS], next[NUM_MAP_LOCATIONS], reach[NUM_MAP_LOCATIONS];
+    int turns, still = 0, grew, p, q;
+
+    memset(at, 0, sizeof(at));
+    at[src] = 1;
+    for (turns = 0; !at[dest]; turns++) {
+        // how far the train goes repeats every 4 rounds
+        if (still == 4) return NO_PATH;
+        memcpy(next, at, sizeof(next));
+        for (p = 0; p < NUM_MAP_LOCATIONS; p++) {
+            if (!at[p]) continue;
+            refMoves(reach, p, player, round + turns, transport & BY_ROAD,
+                     transport & BY_RAIL, transport & BY_SEA);
+            for (q = 0; q < NUM_MAP_LOCATIONS; q++) next[q] |= reach[q];
+        }
+        grew = memcmp(next, at, sizeof(at)) != 0;
+        still = grew ? 0 : still + 1;
+        memcpy(at, next, sizeof(at));
+    }
+    return turns;
+}
+
+// whether path[0 ... length] is a legal way from src to dest
+static int legalPath(LocationID *path, int length, LocationID src, LocationID dest,
+                     PlayerID player, Round round, int transport) {
+    int reach[NUM_MAP_LOCATIONS], i;
+
+    if (path[0] != src || path[length] != dest) return FALSE;
+    for (i = 0; i < length; i++) {
+        if (!validPlace(path[i + 1])) return FALSE;
+        refMoves(reach, path[i], player, round + i, transport & BY_ROAD,
+                 transport & BY_RAIL, transport & BY_SEA);
+        if (!reach[path[i + 1]]) return FALSE;
+    }
+    return TRUE;
+}
+
+// what a two letter move in a play stands for
+static LocationID refMove(char *abbrev) {
+    char place[3] = {abbrev[0], abbrev[1], '\0'};
+
+    if (strcmp(place, "C?") == 0) return CITY_UNKNOWN;
+    if (strcmp(place, "S?") == 0) return SEA_UNKNOWN;
+    if (strcmp(place, "HI") == 0) return HIDE;
+    if (strcmp(place, "TP") == 0) return TELEPORT;
+    if (place[0] == 'D' && place[1] >= '1' && place[1] <= '5') return DOUBLE_BACK_1 + place[1] - '1';
+    return abbrevToID(place);
+}
+
+// each player's last TRAIL_SIZE moves in plays (turns plays long)
+static void refHistory(char *plays, int turns, LocationID history[NUM_PLAYERS][TRAIL_SIZE]) {
+    int count[NUM_PLAYERS] = {0};
+    int turn, player;
+
+    for (player = 0; player < NUM_PLAYERS; player++) {
+        for (turn = 0; turn < TRAIL_SIZE; turn++) history[player][turn] = UNKNOWN_LOCATION;
+    }
+    for (turn = turns - 1; turn >= 0; turn--) {
+        player = turn % NUM_PLAYERS;
+        if (count[player] == TRAIL_SIZE) continue;
+        history[player][count[player]++] = refMove(&plays[turn * PLAY_SIZE + 1]);
+    }
+}
+
+//// Checking connectedLocations() and the path functions
+
+static int sameSet(LocationID *list, int n, int reach[NUM_MAP_LOCATIONS]) {
+    int seen[NUM_MAP_LOCATIONS] = {0};
+    int count = 0, i;
+
+    for (i = 0; i < n; i++) {
+        if (!validPlace(list[i]) || seen[list[i]] || !reach[list[i]]) return FALSE;
+        seen[list[i]] = 1;
+    }
+    for (i = 0; i < NUM_MAP_LOCATIONS; i++) count += reach[i];
+    return count == n;
+}
+
+static void checkMoves(LocationID from, PlayerID player, Round round) {
+    LocationID moves[NUM_MAP_LOCATIONS], *list = NULL;
+    int reach[NUM_MAP_LOCATIONS], mask, n = 0, road, rail, sea;
+
+    for (mask = 1; mask < NUM_MASKS; mask++) {
+        road = (mask & BY_ROAD) != 0;
+        rail = (mask & BY_RAIL) != 0;
+        sea = (mask & BY_SEA) != 0;
+        refMoves(reach, from, player, round, road, rail, sea);
+        COST(COST_CONNECTED, list = connectedLocations(&n, from, player, round, road, rail, sea));
+        if (!sameSet(list, n, reach)) {
+            fail("connectedLocations(%s, player %d, round %d, mask %d) is wrong",
+                 idToName(from), player, round, mask);
+        }
+        free(list);
+        COST(COST_FILL, n = fillConnectedLocations(moves, from, player, round, road, rail, sea));
+        if (!sameSet(moves, n, reach)) {
+            fail("fillConnectedLocations(%s, player %d, round %d, mask %d) is wrong",
+                 idToName(from), player, round, mask);
+        }
+    }
+}
+
+static void checkPaths(LocationID from, PlayerID player, Round round) {
+    LocationID path[NUM_MAP_LOCATIONS], dest;
+    int transport, want, got, check;
+
+    for (check = 0; check < PATH_CHECKS; check++) {
+        dest = rand_r(&checkSeed) % NUM_MAP_LOCATIONS;
+        if (player == PLAYER_DRACULA && dest == ST_JOSEPH_AND_ST_MARYS) continue;
+        transport = (check == 0) ? BY_ANY : 1 + rand_r(&checkSeed) % (NUM_MASKS - 1);
+
+        want = refDistance(from, dest, player, round, transport);
+        COST(COST_DISTANCE, got = shortestDistance(from, dest, player, round, transport));
+        if (got != want) {
+            fail("shortestDistance(%s, %s, player %d, round %d, mask %d) is %d, should be %d",
+                 idToName(from), idToName(dest), player, round, transport, got, want);
+        }
+        if (transport != BY_ANY) continue;
+
+        COST(COST_PATH, got = findPathLength(from, dest, player, round, path));
+        if (got != want || (got != NO_PATH && !legalPath(path, got, from, dest, player, round, BY_ANY))) {
+            fail("findPathLength(%s, %s, player %d, round %d) gave a wrong route",
+                 idToName(from), idToName(dest), player, round);
+        }
+        if (player == PLAYER_DRACULA) continue;
+        COST(COST_ROUTE, got = hunterRoute(from, dest, player, round, BY_ANY, path));
+        if (got != want || (got != NO_PATH && !legalPath(path, got, from, dest, player, round, BY_ANY))) {
+            fail("hunterRoute(%s, %s, player %d, round %d) gave a wrong route",
+                 idToName(from), idToName(dest), player, round);
+        }
+    }
+}
+
+
+//// Checking the views
+
+// what a GameView should say about the game so far
+static void checkGameView(GameView view, RandomGame *g, char *plays) {
+    LocationID history[NUM_PLAYERS][TRAIL_SIZE], trail[TRAIL_SIZE];
+    GameState *state = &g->state;
+    int numTraps, numVamps, wantTraps, wantVamps, i;
+    LocationID place;
+    PlayerID p;
+
+    EXPECT("getRound", getRound(view), state->round);
+    EXPECT("getCurrentPlayer", getCurrentPlayer(view), state->player);
+    EXPECT("getScore", getScore(view), state->score);
+    refHistory(plays, g->turns, history);
+    for (p = 0; p < NUM_PLAYERS; p++) {
+        EXPECT("getHealth", getHealth(view, p), state->health[p]);
+        getHistory(view, p, trail);
+        for (i = 0; i < TRAIL_SIZE; i++) EXPECT("getHistory", trail[i], history[p][i]);
+    }
+    for (p = 0; p < PLAYER_DRACULA; p++) {
+        EXPECT("getLocation", getLocation(view, p), state->location[p]);
+    }
+    // Dracula's as played, hides and double backs included
+    EXPECT("getLocation(Dracula)", getLocation(view, PLAYER_DRACULA), history[PLAYER_DRACULA][0]);
+
+    // only Dracula sees every trap and vampire, the hunters no more than
+    //  are there (and never fewer than none)
+    for (place = MIN_MAP_LOCATION; place <= MAX_MAP_LOCATION; place++) {
+        wantTraps = wantVamps = 0;
+        for (i = 0; i < TRAIL_SIZE; i++) {
+            if (state->trail[i] != place) continue;
+            if (state->minions[i] & TRAP_HERE) wantTraps++;
+            if (state->minions[i] & VAMPIRE_HERE) wantVamps++;
+        }
+        getMinions(view, place, &numTraps, &numVamps);
+        if (plays == g->plays) {
+            EXPECT("getMinions traps", numTraps, wantTraps);
+            EXPECT("getMinions vampires", numVamps, wantVamps);
+        } else if (numTraps < 0 || numTraps > wantTraps || numVamps < 0 || numVamps > wantVamps) {
+            fail("getMinions(%s) for the hunters is %d traps and %d vampires of %d and %d",
+                 idToName(place), numTraps, numVamps, wantTraps, wantVamps);
+        }
+    }
+}
+
+#ifdef I_AM_DRACULA
+
+//// Dracula's moves under the trail rules
+
+// One of Dracula's trails as far as the rules care: the last five places
+// and the moves that took him there, with the first place of the route
+// that got to it. Searched breadth first with nothing left out, to check
+// dracDistance() and dracReachable(), which prune the trail as they go.
+typedef struct refDrac {
+    LocationID place[TRAIL_SIZE - 1];     // NOWHERE if not known
+    LocationID move[TRAIL_SIZE - 1];      // the place, HIDE or DOUBLE_BACK_n
+    LocationID first;                     // where the first move went
+} RefDrac;
+
+#define REF_DRAC_MOVES     4              // how deep the reference searches
+#define REF_SEEN_BITS      18
+
+static unsigned long long refSeen[1 << REF_SEEN_BITS];
+static RefDrac refLayers[2][1 << (REF_SEEN_BITS - 1)];
+
+// a number for the whole of a trail, so the same one isn't searched twice
+static unsigned long long refKey(RefDrac *d) {
+    unsigned long long key = validPlace(d->first) ? d->first : NUM_MAP_LOCATIONS;
+    int i, kind;
+
+    for (i = 0; i < TRAIL_SIZE - 1; i++) {
+        kind = (d->move[i] == HIDE) ? 1 : (d->move[i] >= DOUBLE_BACK_1 && d->move[i] <= DOUBLE_BACK_5) ? 2 : 0;
+        key = (key << 9) | ((validPlace(d->place[i]) ? d->place[i] : NUM_MAP_LOCATIONS) << 2) | kind;
+    }
+    return key + 1;
+}
+
+// returns 1 if d hadn't been seen yet (0 is never a key, so it means empty)
+static int refFirstSeen(RefDrac *d) {
+    unsigned long long key = refKey(d);
+    unsigned int i = (key * 0x9E3779B97F4A7C15ULL) >> (64 - REF_SEEN_BITS);
+
+    while (refSeen[i] != 0) {
+        if (refSeen[i] == key) return 0;
+        i = (i + 1) & ((1 << REF_SEEN_BITS) - 1);
+    }
+    refSeen[i] = key;
+    return 1;
+}
+
+// the trail after Dracula makes move, ending up at place
+static RefDrac refDracMove(RefDrac *d, LocationID place, LocationID move) {
+    RefDrac next = *d;
+    int i;
+
+    for (i = TRAIL_SIZE - 2; i > 0; i--) {
+        next.place[i] = d->place[i - 1];
+        next.move[i] = d->move[i - 1];
+    }
+    next.place[0] = place;
+    next.move[0] = move;
+    return next;
+}
+
+// every trail Dracula can have after his next move, as the rules say:
+//  by road or boat to a place not in his last five (never the hospital),
+//  a hide where he is if there is none in them and he isn't at sea, or
+//  a double back to one of them he is at or next to if there is none
+static int refDracMoves(RefDrac *d, int hideAllow, RefDrac next[NUM_MAP_LOCATIONS + TRAIL_SIZE]) {
+    int reach[NUM_MAP_LOCATIONS], hidden = 0, doubledBack = 0, onTrail, n = 0, i;
+    LocationID here = d->place[0], to;
+
+    refMoves(reach, here, PLAYER_DRACULA, 0, TRUE, FALSE, TRUE);
+    for (i = 0; i < TRAIL_SIZE - 1; i++) {
+        if (d->move[i] == HIDE) hidden = 1;
+        if (d->move[i] >= DOUBLE_BACK_1 && d->move[i] <= DOUBLE_BACK_5) doubledBack = 1;
+    }
+    for (to = MIN_MAP_LOCATION; to <= MAX_MAP_LOCATION; to++) {
+        if (!reach[to] || to == here || to == ST_JOSEPH_AND_ST_MARYS) continue;
+        for (onTrail = 0, i = 0; i < TRAIL_SIZE - 1; i++) onTrail |= (d->place[i] == to);
+        if (!onTrail) next[n++] = refDracMove(d, to, to);
+    }
+    if (!hideAllow) return n;
+    if (!hidden && !isSea(here)) next[n++] = refDracMove(d, here, HIDE);
+    for (i = 0; i < TRAIL_SIZE - 1 && !doubledBack; i++) {
+        to = d->place[i];
+        if (!validPlace(to) || !reach[to] || to == ST_JOSEPH_AND_ST_MARYS) continue;
+        next[n++] = refDracMove(d, to, DOUBLE_BACK_1 + i);
+    }
+    return n;
+}
+
+// check the trail searches from Dracula's trail in state against a
+//  breadth first search of every trail he can have in up to
+//  REF_DRAC_MOVES moves, with and without hides and double backs
+static void checkDracReach(GameState *state) {
+    LocationID trail[TRAIL_SIZE], moves[TRAIL_SIZE], first;
+    LocSet reached[REF_DRAC_MOVES + 1], firsts[NUM_MAP_LOCATIONS], got;
+    RefDrac next[NUM_MAP_LOCATIONS + TRAIL_SIZE];
+    int dist[NUM_MAP_LOCATIONS], size[2], hideAllow, moved, n, i, j, k, want;
+    LocationID place;
+    DracState packed;
+
+    for (i = 0; i < TRAIL_SIZE; i++) {
+        trail[i] = state->trail[i];
+        moves[i] = state->moves[i];
+    }
+    if (!validPlace(trail[0])) return;
+    packed = dracState(trail, moves);
+    if (dracStateLocation(packed) != trail[0]) fail("dracStateLocation is wrong");
+
+    for (hideAllow = 0; hideAllow <= 1; hideAllow++) {
+        memset(refSeen, 0, sizeof(refSeen));
+        for (place = 0; place < NUM_MAP_LOCATIONS; place++) {
+            dist[place] = NO_PATH;
+            firsts[place] = emptySet();
+        }
+        for (i = 0; i < TRAIL_SIZE - 1; i++) {
+            refLayers[0][0].place[i] = validPlace(trail[i]) ? trail[i] : NOWHERE;
+            refLayers[0][0].move[i] = moves[i];
+        }
+        refLayers[0][0].first = NOWHERE;
+        refFirstSeen(&refLayers[0][0]);
+        size[0] = 1;
+        dist[trail[0]] = 0;
+        reached[0] = singletonSet(trail[0]);
+        for (moved = 1; moved <= REF_DRAC_MOVES; moved++) {
+            RefDrac *from = refLayers[(moved - 1) % 2], *to = refLayers[moved % 2];
+            reached[moved] = reached[moved - 1];
+            size[moved % 2] = 0;
+            for (i = 0; i < size[(moved - 1) % 2]; i++) {
+                n = refDracMoves(&from[i], hideAllow, next);
+                for (j = 0; j < n; j++) {
+                    if (moved == 1) next[j].first = next[j].place[0];
+                    if (!refFirstSeen(&next[j])) continue;
+                    place = next[j].place[0];
+                    addToSet(&reached[moved], place);
+                    if (dist[place] == NO_PATH) dist[place] = moved;
+                    if (dist[place] == moved) addToSet(&firsts[place], next[j].first);
+                    if (size[moved % 2] == (1 << (REF_SEEN_BITS - 1))) {
+                        fail("the reference search for Dracula ran out of room");
+                        return;
+                    }
+                    to[size[moved % 2]++] = next[j];
+                }
+            }
+        }
+
+        for (k = 0; k <= REF_DRAC_MOVES; k++) {
+            got = dracReachable(packed, k, hideAllow);
+            if (!setIsEmpty(setMinus(got, reached[k])) || !setIsEmpty(setMinus(reached[k], got))) {
+                fail("dracReachable(%s, %d moves, hides %d) is wrong", idToName(trail[0]), k, hideAllow);
+            }
+        }
+        for (place = MIN_MAP_LOCATION; place <= MAX_MAP_LOCATION; place++) {
+            first = NOWHERE;
+            want = dracDistance(packed, place, hideAllow, &first);
+            if (dist[place] == NO_PATH ? (want != NO_PATH && want <= REF_DRAC_MOVES)
+                                       : want != dist[place]) {
+                fail("dracDistance(%s to %s, hides %d) is %d, not %d", idToName(trail[0]),
+                     idToName(place), hideAllow, want, dist[place]);
+            } else if (dist[place] > 0 && !inSet(firsts[place], first)) {
+                fail("dracDistance(%s to %s, hides %d) starts off wrong", idToName(trail[0]),
+                     idToName(place), hideAllow);
+            }
+        }
+    }
+}
+
+static void checkView(DracView view, DracView grown, RandomGame *g) {
+    LocationID trail[TRAIL_SIZE], moves[TRAIL_SIZE], start, end;
+    int reach[NUM_MAP_LOCATIONS], numTraps, numVamps, wantTraps, wantVamps, n, i;
+    GameState *state = &g->state;
+    LocationID place, *list, want;
+    PlayerID p;
+
+    EXPECT("giveMeTheRound", giveMeTheRound(view), state->round);
+    EXPECT("giveMeTheScore", giveMeTheScore(view), state->score);
+    for (p = 0; p < NUM_PLAYERS; p++) {
+        EXPECT("howHealthyIs", howHealthyIs(view, p), state->health[p]);
+        EXPECT("whereIs", whereIs(view, p), state->location[p]);
+        EXPECT("whereIs (grown a play at a time)", whereIs(grown, p), whereIs(view, p));
+        EXPECT("howHealthyIs (grown a play at a time)", howHealthyIs(grown, p), howHealthyIs(view, p));
+    }
+    lastMove(view, PLAYER_DRACULA, &start, &end);
+    giveMeTheTrail(view, PLAYER_DRACULA, moves, TRUE);
+    EXPECT("lastMove end", end, moves[0]);
+    EXPECT("lastMove start", start, moves[1]);
+
+    giveMeTheTrail(view, PLAYER_DRACULA, trail, FALSE);
+    for (i = 0; i < TRAIL_SIZE; i++) {
+        EXPECT("giveMeTheTrail", trail[i], state->trail[i]);
+        EXPECT("giveMeTheTrail with hides", moves[i], state->moves[i]);
+    }
+    for (place = MIN_MAP_LOCATION; place <= MAX_MAP_LOCATION; place++) {
+        wantTraps = wantVamps = 0;
+        want = -1;
+        for (i = TRAIL_SIZE - 1; i >= 0; i--) {
+            if (state->trail[i] != place) continue;
+            want = i;
+            if (state->minions[i] & TRAP_HERE) wantTraps++;
+            if (state->minions[i] & VAMPIRE_HERE) wantVamps++;
+        }
+        whatsThere(view, place, &numTraps, &numVamps);
+        EXPECT("whatsThere traps", numTraps, wantTraps);
+        EXPECT("whatsThere vampires", numVamps, wantVamps);
+        EXPECT("trailPosition", trailPosition(view, place), want);
+        EXPECT("trailMove", trailMove(view, place), (want < 0) ? NOWHERE : state->moves[want]);
+        EXPECT("trailPosition (grown a play at a time)", trailPosition(grown, place), want);
+    }
+    EXPECT("specialMovesInTrail", specialMovesInTrail(view), hasDBOrHI(moves));
+    EXPECT("doubleBackPosition", doubleBackPosition(view), posOfDb(moves));
+
+    for (p = 0; p < PLAYER_DRACULA; p++) {
+        if (!validPlace(state->location[p])) continue;
+        refMoves(reach, state->location[p], p, state->round, TRUE, TRUE, TRUE);
+        list = whereCanTheyGo(view, &n, state->location[p], p, state->round, TRUE, TRUE, TRUE);
+        if (!sameSet(list, n, reach)) fail("whereCanTheyGo(player %d) is wrong", p);
+        free(list);
+    }
+    checkDracReach(state);
+}
+
+#else
+
+// where a trail of moves (as in a history) takes Dracula each time, as
+//  far as can be told from the moves themselves
+static LocationID refResolve(LocationID moves[TRAIL_SIZE], int i) {
+    if (i >= TRAIL_SIZE) return UNKNOWN_LOCATION;
+    if (moves[i] == HIDE) return refResolve(moves, i + 1);
+    if (moves[i] >= DOUBLE_BACK_1 && moves[i] <= DOUBLE_BACK_5) {
+        return refResolve(moves, i + moves[i] - DOUBLE_BACK_1 + 1);
+    }
+    if (moves[i] == TELEPORT) return CASTLE_DRACULA;
+    return moves[i];
+}
+
+static void checkView(HunterView view, HunterView grown, RandomGame *g) {
+    LocationID history[NUM_PLAYERS][TRAIL_SIZE], trail[TRAIL_SIZE];
+    int reach[NUM_MAP_LOCATIONS], n, i;
+    GameState *state = &g->state;
+    DracBelief belief, wantBelief;
+    LocationID place, *list, want;
+    HunterView batched;
+    PlayerID p;
+    int split;
+
+    EXPECT("giveMeTheRound", giveMeTheRound(view), state->round);
+    EXPECT("whoAmI", whoAmI(view), state->player);
+    EXPECT("giveMeTheScore", giveMeTheScore(view), state->score);
+    refHistory(g->hunterPlays, g->turns, history);
+    for (p = 0; p < NUM_PLAYERS; p++) {
+        EXPECT("howHealthyIs", howHealthyIs(view, p), state->health[p]);
+        EXPECT("howHealthyIs (grown a play at a time)", howHealthyIs(grown, p), howHealthyIs(view, p));
+        giveMeTheTrail(view, p, trail);
+        for (i = 0; i < TRAIL_SIZE; i++) EXPECT("giveMeTheTrail", trail[i], history[p][i]);
+    }
+    for (p = 0; p < PLAYER_DRACULA; p++) {
+        EXPECT("whereIs", whereIs(view, p), state->location[p]);
+        EXPECT("whereIs (grown a play at a time)", whereIs(grown, p), state->location[p]);
+    }
+    // (a view grown a play at a time can't see moves of Dracula's that
+    //  were shown to the hunters after they were played, so not that one)
+    want = refResolve(history[PLAYER_DRACULA], 0);
+    if (want != UNKNOWN_LOCATION) EXPECT("whereIs(Dracula)", whereIs(view, PLAYER_DRACULA), want);
+
+    // the newest trail entry each place is known to be behind
+    for (place = MIN_MAP_LOCATION; place <= MAX_MAP_LOCATION; place++) {
+        want = -1;
+        for (i = TRAIL_SIZE - 1; i >= 0; i--) {
+            if (refResolve(history[PLAYER_DRACULA], i) == place) want = i;
+        }
+        EXPECT("trailPosition", trailPosition(view, place), want);
+        EXPECT("trailMove", trailMove(view, place),
+               (want < 0) ? NOWHERE : history[PLAYER_DRACULA][want]);
+    }
+    EXPECT("specialMovesInTrail", specialMovesInTrail(view), hasDBOrHI(history[PLAYER_DRACULA]));
+    EXPECT("doubleBackPosition", doubleBackPosition(view), posOfDb(history[PLAYER_DRACULA]));
+
+    // the belief is moved on a play at a time, so it should be just what
+    //  a fresh start over the same plays gives
+    beliefFromPlays(&wantBelief, g->hunterPlays);
+    whereMightDraculaBe(view, &belief);
+    if (memcmp(belief.chance, wantBelief.chance, sizeof(belief.chance)) != 0) {
+        fail("whereMightDraculaBe is wrong");
+    }
+    // the same plays in two batches, each with spaces left around it the
+    //  way a client might send them, asked only at the end (so the belief
+    //  is worked out from the view's own copy of the plays)
+    split = rand_r(&checkSeed) % g->turns;
+    memcpy(batch, g->hunterPlays, split * PLAY_SIZE);
+    batch[split * PLAY_SIZE] = '\0';
+    batched = newHunterView(batch, messages);
+    snprintf(batch, sizeof(batch), " %s ", &g->hunterPlays[split * PLAY_SIZE]);
+    appendHunterPlays(batched, batch, messages);
+    EXPECT("giveMeTheRound (given in two batches)", giveMeTheRound(batched), state->round);
+    whereMightDraculaBe(batched, &belief);
+    if (memcmp(belief.chance, wantBelief.chance, sizeof(belief.chance)) != 0) {
+        fail("whereMightDraculaBe (given in two batches, %d plays first) is wrong", split);
+    }
+    disposeHunterView(batched);
+    beliefFromPlays(&wantBelief, grownPlays);
+    whereMightDraculaBe(grown, &belief);
+    if (memcmp(belief.chance, wantBelief.chance, sizeof(belief.chance)) != 0) {
+        fail("whereMightDraculaBe (grown a play at a time) is wrong");
+    }
+
+    for (p = 0; p < PLAYER_DRACULA; p++) {
+        if (!validPlace(state->location[p])) continue;
+        refMoves(reach, state->location[p], p, state->round, TRUE, TRUE, TRUE);
+        list = whereCanTheyGo(view, &n, p, TRUE, TRUE, TRUE);
+        if (!sameSet(list, n, reach)) fail("whereCanTheyGo(player %d) is wrong", p);
+        free(list);
+    }
+}
+
+#endif
+
+
+//// Recording costs
+
+// keep the cost if it is one of the slowest so far (by time per call)
+static void keepIfSlow(int f, Cost *c) {
+    Cost *kept = slowest[f];
+    int i;
+
+    if (numKept[f] == numSlowest &&
+        c->ns / c->calls <= kept[numKept[f] - 1].ns / kept[numKept[f] - 1].calls) return;
+    if (numKept[f] < numSlowest) numKept[f]++;
+    for (i = numKept[f] - 1; i > 0 && c->ns / c->calls > kept[i - 1].ns / kept[i - 1].calls; i--) {
+        kept[i] = kept[i - 1];
+    }
+    kept[i] = *c;
+}
+
+static void recordCosts(void) {
+    int f;
+
+    for (f = 0; f < NUM_COSTS; f++) {
+        if (now[f].calls == 0) continue;
+        now[f].seed = gameSeed;
+        now[f].turn = gameTurn;
+        if (costFile != NULL) {
+            fprintf(costFile, "%d %d %s %ld %.0f %ld\n", gameSeed, gameTurn, costNames[f],
+                    now[f].calls, now[f].ns, MALLOCS_COUNTED ? now[f].mallocs : -1L);
+        }
+        total[f].calls += now[f].calls;
+        total[f].ns += now[f].ns;
+        total[f].mallocs += now[f].mallocs;
+        keepIfSlow(f, &now[f]);
+    }
+    memset(now, 0, sizeof(now));
+}
+
+static void report(int games, long states) {
+    int f, i;
+
+    fprintf(out, "%d games, %ld states checked, %d difference%s\n",
+            games, states, failures, (failures == 1) ? "" : "s");
+    fprintf(out, "%-24s %10s %10s %12s\n", "function", "calls", "mean ns", "mallocs/call");
+    for (f = 0; f < NUM_COSTS; f++) {
+        if (total[f].calls == 0) continue;
+        fprintf(out, "%-24s %10ld %10.1f %12.2f\n", costNames[f], total[f].calls,
+                total[f].ns / total[f].calls,
+                MALLOCS_COUNTED ? (double)total[f].mallocs / total[f].calls : -1.0);
+    }
+    fprintf(out, "slowest states (ns per call, mallocs per call):\n");
+    for (f = 0; f < NUM_COSTS; f++) {
+        for (i = 0; i < numKept[f]; i++) {
+            fprintf(out, "  %-24s seed %d turn %d: %.1f ns, %.2f mallocs\n", costNames[f],
+                    slowest[f][i].seed, slowest[f][i].turn,
+                    slowest[f][i].ns / slowest[f][i].calls,
+                    MALLOCS_COUNTED ? (double)slowest[f][i].mallocs / slowest[f][i].calls : -1.0);
+        }
+    }
+}
+
+
+//// Playing the games
+
+// check the views and the map functions after every stride turns
+static long fuzzGame(RandomGame *g, int seed, int wild, int stride) {
+    char *plays, play[PLAY_SIZE + 1];
+    GameView view;
+    long states = 0;
+    int at;
+    PlayerID p;
+#ifdef I_AM_DRACULA
+    DracView aiView, grown;
+#else
+    HunterView aiView, grown;
+#endif
+
+    gameSeed = seed;
+    gameWild = wild;
+    checkSeed = seed;
+    startRandomGame(g, seed, wild);
+#ifdef I_AM_DRACULA
+    plays = g->plays;
+    grown = newDracView("", messages);
+#else
+    plays = g->hunterPlays;
+    grown = newHunterView("", messages);
+    grownPlays[0] = '\0';
+#endif
+    while (playRandomTurn(g)) {
+        gameTurn = g->turns;
+        at = (g->turns - 1) * PLAY_SIZE;
+        // every third play is given with the space after it left on
+        memcpy(play, &plays[at], PLAY_SIZE - 1);
+        play[PLAY_SIZE - 1] = ' ';
+        play[(g->turns % 3 == 0) ? PLAY_SIZE : PLAY_SIZE - 1] = '\0';
+#ifdef I_AM_DRACULA
+        appendDracPlays(grown, play, messages);
+#else
+        appendHunterPlays(grown, play, messages);
+        if (grownPlays[0] != '\0') strcat(grownPlays, " ");
+        strncat(grownPlays, play, PLAY_SIZE - 1);
+#endif
+        if (g->turns % stride != 0) continue;
+
+        plays[at + PLAY_SIZE - 1] = '\0';
+        view = newGameView(plays, messages);
+        checkGameView(view, g, plays);
+        disposeGameView(view);
+#ifdef I_AM_DRACULA
+        aiView = newDracView(plays, messages);
+        checkView(aiView, grown, g);
+        disposeDracView(aiView);
+#else
+        aiView = newHunterView(plays, messages);
+        checkView(aiView, grown, g);
+        disposeHunterView(aiView);
+#endif
+        plays[at + PLAY_SIZE - 1] = ' ';
+
+        for (p = 0; p < NUM_PLAYERS; p++) {
+            if (!validPlace(g->state.location[p])) continue;
+            checkMoves(g->state.location[p], p, g->state.round);
+            checkPaths(g->state.location[p], p, g->state.round);
+        }
+        recordCosts();
+        states++;
+    }
+#ifdef I_AM_DRACULA
+    disposeDracView(grown);
+#else
+    disposeHunterView(grown);
+#endif
+    return states;
+}
+
+int main(int argc, char *argv[]) {
+    int numGames = 20, seed = 1, wild = 10, stride = 1, game, opt;
+    char *costPath = NULL;
+    RandomGame *g;
+    long states = 0;
+
+    while ((opt = getopt(argc, argv, "n:s:w:k:t:o:")) != -1) {
+        switch (opt) {
+            case 'n': numGames = atoi(optarg); break;
+            case 's': seed = atoi(optarg); break;
+            case 'w': wild = atoi(optarg); break;
+            case 'k': stride = atoi(optarg); break;
+            case 't': numSlowest = atoi(optarg); break;
+            case 'o': costPath = optarg; break;
+            default:
+                fprintf(stderr, "usage: %s [-n games] [-s seed] [-w wild percent] "
+                        "[-k stride] [-t slowest] [-o costs file]\n", argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+    if (numGames < 1) numGames = 1;
+    if (stride < 1) stride = 1;
+    if (numSlowest < 0) numSlowest = 0;
+    if (numSlowest > MAX_SLOWEST) numSlowest = MAX_SLOWEST;
+
+    // the views print as they go, so the results are written to a copy
+    //  of stdout and stdout itself thrown away
+    out = fdopen(dup(STDOUT_FILENO), "w");
+    if (out == NULL || freopen("/dev/null", "w", stdout) == NULL) {
+        perror("stdout");
+        return EXIT_FAILURE;
+    }
+    if (costPath != NULL && (costFile = fopen(costPath, "w")) == NULL) {
+        perror(costPath);
+        return EXIT_FAILURE;
+    }
+
+    // the distance tables are built now so that the first state checked
+    //  isn't charged for them
+    graph = newGraph();
+    buildDistances();
+    g = malloc(sizeof(RandomGame));
+    if (g == NULL) {
+        perror("game");
+        return EXIT_FAILURE;
+    }
+    for (game = 0; game < numGames && failures <= MAX_FAILURES; game++) {
+        states += fuzzGame(g, seed + game, wild, stride);
+    }
+    report(game, states);
+
+    free(g);
+    disposeMap(graph);
+    if (costFile != NULL) fclose(costFile);
+    fclose(out);
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,109 @@
+// gamerec.c ... convert games between past plays text and binary records
+//
+// usage: ./gamerec pack [text file]    games, one per line, to records on stdout
+//        ./gamerec unpack <records>    records to games, one per line
+//        ./gamerec replay <records>    play every game through a GameView
+//                                      and report how long it took
+//
+// See GameRecord.h for the format.
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "Game.h"
+#include "GameView.h"
+#include "GameRecord.h"
+
+#define MAX_LINE     ((GAME_START_SCORE + 1) * NUM_PLAYERS * (PLAY_CHARS + 1) + 2)
+
+static int usage(char *name)
+{
+    fprintf(stderr, "usage: %s pack [text file] | unpack <records> | replay <records>\n", name);
+    return EXIT_FAILURE;
+}
+
+static int pack(FILE *in)
+{
+    static char line[MAX_LINE];
+    RecordWriter writer = newRecordWriter(stdout);
+    int lineNo = 0, bad = 0;
+
+    while (fgets(line, sizeof(line), in) != NULL) {
+        lineNo++;
+        line[strcspn(line, "\r\n")] = '\0';
+        if (writeGame(writer, line) < 0) {
+            fprintf(stderr, "line %d is not a game, skipped\n", lineNo);
+            bad++;
+        }
+    }
+    if (disposeRecordWriter(writer) < 0) {
+        perror("writing records");
+        return EXIT_FAILURE;
+    }
+    return bad ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+static int unpack(RecordReader reader)
+{
+    static char text[MAX_LINE];
+    GameRecord game;
+
+    while (nextGame(reader, &game)) {
+        recordToText(&game, text);
+        puts(text);
+    }
+    return EXIT_SUCCESS;
+}
+
+static int replay(RecordReader reader)
+{
+    GameRecord game;
+    GameView view;
+    struct timespec start, end;
+    long games = 0, plays = 0, score = 0;
+    double seconds;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    while (nextGame(reader, &game)) {
+        view = replayGame(&game, NULL, NULL);
+        score += getScore(view);
+        disposeGameView(view);
+        games++;
+        plays += game.nPlays;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    seconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+    printf("%ld games, %ld plays, mean final score %.1f\n",
+           games, plays, games ? (double)score / games : 0.0);
+    printf("%.3f s, %.2f us per game, %.1f ns per play\n", seconds,
+           games ? seconds * 1e6 / games : 0.0, plays ? seconds * 1e9 / plays : 0.0);
+    return EXIT_SUCCESS;
+}
+
+int main(int argc, char *argv[])
+{
+    RecordReader reader;
+    FILE *in = stdin;
+    int status;
+
+    if (argc < 2) return usage(argv[0]);
+    if (strcmp(argv[1], "pack") == 0 && argc <= 3) {
+        if (argc == 3 && (in = fopen(argv[2], "r")) == NULL) {
+            perror(argv[2]);
+            return EXIT_FAILURE;
+        }
+        status = pack(in);
+        if (in != stdin) fclose(in);
+        return status;
+    }
+    if (argc != 3) return usage(argv[0]);
+    if (strcmp(argv[1], "unpack") != 0 && strcmp(argv[1], "replay") != 0) return usage(argv[0]);
+    if ((reader = openRecords(argv[2])) == NULL) {
+        fprintf(stderr, "%s: can't read records\n", argv[2]);
+        return EXIT_FAILURE;
+    }
+    status = (argv[1][0] == 'u') ? unpack(reader) : replay(reader);
+    closeRecords(reader);
+    return status;
+}
@@ -0,0 +1,372 @@
+// genMap.c ... make MapData.h, the map of Europe as tables, from a list of links
+//
+// usage: ./genMap [links file] > MapData.h    (../LABS/lab_w7/links.txt by default)
+//
+// The links file has a connection a line, "ATHENS, VALONA, ROAD", with the
+// places named as in Places.h and the transport ROAD, RAIL or SEA (by
+// boat). A connection may be listed from either end or from both, and
+// blank lines and lines starting with // are skipped.
+//
+// Map.c used to build each kind of map whenever one was made, adding the
+// links one at a time to a list for each place (newest first) and then
+// packing the lists into one array. The tables written here are those
+// same lists in the same order, so anything that walks a place's
+// connections sees them as it always has: the links are added roads
+// first, then rails, then boats, each in the order of the places' names,
+// and the rail map's extra stops are worked out just as Map.c did.
+//
+// See MapData.h for what is in the tables.
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <assert.h>
+#include "Places.h"
+#include "Map.h"
+
+#define MAX_LINKS      1000          // of each kind of transport
+#define MAX_NAME       32            // longest name in Places.h, and some
+#define MAX_LINE       256
+#define EDGES_A_LINE   4
+#define NUMS_A_LINE    12
+
+typedef struct link {
+    LocationID a, b;                 // a's name comes first
+} Link;
+
+typedef struct vNode *VList;
+
+struct vNode {
+    LocationID  v;
+    TransportID type;
+    VList       next;
+};
+
+typedef struct lists {
+    VList connections[NUM_MAP_LOCATIONS];
+    int   nE;
+} Lists;
+
+static char names[NUM_MAP_LOCATIONS][MAX_NAME];    // as in Places.h
+static Link links[MAX_TRANSPORT + 1][MAX_LINKS];
+static int numLinks[MAX_TRANSPORT + 1];
+
+static char *kindNames[NUM_MAP_KINDS] = {
+    "BASIC_MAP", "ONE_RAIL_MAP", "RAIL_MAP", "FULL_GRAPH", "RAIL_GRAPH"
+};
+static char *linkCounts[NUM_MAP_KINDS] = {
+    "BASIC_MAP_LINKS", "ONE_RAIL_MAP_LINKS", "RAIL_MAP_LINKS", "FULL_GRAPH_LINKS", "RAIL_GRAPH_LINKS"
+};
+
+static char *typeName(TransportID type) {
+    switch (type) {
+        case ROAD:   return "ROAD";
+        case RAIL:   return "RAIL";
+        case BOAT:   return "BOAT";
+        case RAIL_1: return "RAIL_1";
+        case RAIL_2: return "RAIL_2";
+        case RAIL_3: return "RAIL_3";
+    }
+    assert(0);
+    return NULL;
+}
+
+
+//// Reading the links
+
+// "Clermont-Ferrand" is CLERMONT_FERRAND and so on
+static void makeNames(void) {
+    LocationID p;
+    char *c;
+    int i;
+
+    for (p = MIN_MAP_LOCATION; p <= MAX_MAP_LOCATION; p++) {
+        for (i = 0, c = idToName(p); *c != '\0'; c++, i++) {
+            assert(i < MAX_NAME - 1);
+            names[p][i] = isalnum((unsigned char)*c) ? toupper((unsigned char)*c) : '_';
+        }
+        names[p][i] = '\0';
+    }
+}
+
+static LocationID nameToPlace(char *name) {
+    LocationID p;
+    for (p = MIN_MAP_LOCATION; p <= MAX_MAP_LOCATION; p++) {
+        if (strcmp(names[p], name) == 0) return p;
+    }
+    return NOWHERE;
+}
+
+static int compareLinks(const void *x, const void *y) {
+    const Link *l = x, *m = y;
+    int order = strcmp(names[l->a], names[m->a]);
+    return (order != 0) ? order : strcmp(names[l->b], names[m->b]);
+}
+
+static void readLinks(char *path) {
+    char line[MAX_LINE], from[MAX_LINE], to[MAX_LINE], by[MAX_LINE];
+    int lineNo = 0, i, n;
+    TransportID type;
+    Link link;
+    FILE *in;
+
+    if ((in = fopen(path, "r")) == NULL) {
+        perror(path);
+        exit(EXIT_FAILURE);
+    }
+    while (fgets(line, MAX_LINE, in) != NULL) {
+        lineNo++;
+        if (sscanf(line, " %s", from) != 1 || strncmp(from, "//", 2) == 0) continue;
+        if (sscanf(line, " %[^, ] , %[^, ] , %s", from, to, by) != 3) {
+            fprintf(stderr, "%s:%d: can't read the link\n", path, lineNo);
+            exit(EXIT_FAILURE);
+        }
+        if (strcmp(by, "ROAD") == 0) type = ROAD;
+        else if (strcmp(by, "RAIL") == 0) type = RAIL;
+        else if (strcmp(by, "SEA") == 0) type = BOAT;
+        else {
+            fprintf(stderr, "%s:%d: no such transport as %s\n", path, lineNo, by);
+            exit(EXIT_FAILURE);
+        }
+        link.a = nameToPlace(from);
+        link.b = nameToPlace(to);
+        if (link.a == NOWHERE || link.b == NOWHERE || link.a == link.b) {
+            fprintf(stderr, "%s:%d: no such link as %s to %s\n", path, lineNo, from, to);
+            exit(EXIT_FAILURE);
+        }
+        if (strcmp(names[link.a], names[link.b]) > 0) {
+            link.a = nameToPlace(to);
+            link.b = nameToPlace(from);
+        }
+
+        // a link listed from both ends is only kept once
+        n = numLinks[type];
+        for (i = 0; i < n; i++) {
+            if (links[type][i].a == link.a && links[type][i].b == link.b) break;
+        }
+        if (i < n) continue;
+        if (n == MAX_LINKS) {
+            fprintf(stderr, "%s: too many links\n", path);
+            exit(EXIT_FAILURE);
+        }
+        links[type][numLinks[type]++] = link;
+    }
+    fclose(in);
+
+    for (type = MIN_TRANSPORT; type <= MAX_TRANSPORT; type++) {
+        qsort(links[type], numLinks[type], sizeof(Link), compareLinks);
+    }
+}
+
+
+//// Building the maps' lists, as Map.c did
+
+static VList insertVList(VList L, LocationID v, TransportID type) {
+    VList newV = malloc(sizeof(struct vNode));
+    assert(newV != NULL);
+    newV->v = v;
+    newV->type = type;
+    newV->next = L;
+    return newV;
+}
+
+static int inVList(VList L, LocationID v, TransportID type) {
+    VList cur;
+    for (cur = L; cur != NULL; cur = cur->next) {
+        if (cur->v == v && (type == ANY || cur->type == type)) return 1;
+    }
+    return 0;
+}
+
+static void addLink(Lists *g, LocationID start, LocationID end, TransportID type) {
+    if (!inVList(g->connections[start], end, type)) {
+        g->connections[start] = insertVList(g->connections[start], end, type);
+        g->connections[end] = insertVList(g->connections[end], start, type);
+        g->nE++;
+    }
+}
+
+// add every link by the given transport, as the given type of connection
+static void addLinks(Lists *g, TransportID by, TransportID type) {
+    int i;
+    for (i = 0; i < numLinks[by]; i++) addLink(g, links[by][i].a, links[by][i].b, type);
+}
+
+// the places another stop down the line, added in front of each place's
+//  list as the given type (a place with none ends up with no list at all,
+//  and the lists of the places already done are looked at as they are
+//  now, which is what Map.c did)
+static void addStops(Lists *g, TransportID type) {
+    VList curr, copy, last, newList;
+    LocationID i;
+
+    for (i = 0; i < NUM_MAP_LOCATIONS; i++) {
+        newList = last = NULL;
+        for (curr = g->connections[i]; curr != NULL; curr = curr->next) {
+            for (copy = g->connections[curr->v]; copy != NULL; copy = copy->next) {
+                if (!inVList(g->connections[i], copy->v, ANY) && !inVList(newList, copy->v, ANY)
+                        && copy->type != RAIL_2 && copy->type != RAIL_3) {
+                    if (newList == NULL) {
+                        newList = last = insertVList(g->connections[i], copy->v, type);
+                    } else {
+                        last->next = insertVList(g->connections[i], copy->v, type);
+                        last = last->next;
+                    }
+                }
+            }
+        }
+        g->connections[i] = newList;
+    }
+}
+
+// the nodes are left for the system to free, as the program ends soon after
+static void buildLists(Lists *g, int kind) {
+    memset(g, 0, sizeof(Lists));
+    switch (kind) {
+        case BASIC_MAP:
+            addLinks(g, ROAD, ROAD);
+            addLinks(g, BOAT, BOAT);
+            break;
+        case ONE_RAIL_MAP:
+        case RAIL_MAP:
+            addLinks(g, RAIL, RAIL_1);
+            if (kind == RAIL_MAP) {
+                addStops(g, RAIL_2);
+                addStops(g, RAIL_3);
+            }
+            addLinks(g, ROAD, ROAD);
+            addLinks(g, BOAT, BOAT);
+            break;
+        case FULL_GRAPH:
+            addLinks(g, ROAD, ROAD);
+            addLinks(g, RAIL, RAIL);
+            addLinks(g, BOAT, BOAT);
+            break;
+        case RAIL_GRAPH:
+            addLinks(g, RAIL, RAIL);
+            break;
+    }
+}
+
+
+//// Writing the header
+
+static void writeHeader(char *path) {
+    static Lists maps[NUM_MAP_KINDS];
+    int counts[NUM_MAP_LOCATIONS][MAX_TRANSPORT + 1];
+    unsigned long long mask[MAX_TRANSPORT + 1][NUM_MAP_LOCATIONS][2];
+    int kind, offset = 0, n;
+    LocationID p;
+    TransportID type;
+    VList curr;
+
+    for (kind = 0; kind < NUM_MAP_KINDS; kind++) buildLists(&maps[kind], kind);
+    memset(counts, 0, sizeof(counts));
+    memset(mask, 0, sizeof(mask));
+    for (p = MIN_MAP_LOCATION; p <= MAX_MAP_LOCATION; p++) {
+        for (curr = maps[FULL_GRAPH].connections[p]; curr != NULL; curr = curr->next) {
+            counts[p][curr->type]++;
+            mask[curr->type][p][curr->v / 64] |= 1ULL << (curr->v % 64);
+        }
+    }
+
+    printf("// MapData.h ... the map of Europe as tables\n");
+    printf("//\n");
+    printf("// Made by genMap from %s (make mapdata),\n", path);
+    printf("// so don't change it by hand.\n");
+    printf("//\n");
+    printf("// The tables are split in two, as a static table nobody uses won't\n");
+    printf("// compile: Map.c defines MAPDATA_TABLES before including this, for the\n");
+    printf("// maps' connections and what is known about each place, and LocSet.c\n");
+    printf("// defines MAPDATA_MASKS, for the neighbour masks.\n");
+    printf("\n");
+    printf("#ifndef MAPDATA_H\n");
+    printf("#define MAPDATA_H\n");
+    printf("\n");
+    printf("#include \"Places.h\"\n");
+    printf("#include \"Map.h\"\n");
+    printf("#include \"LocSet.h\"\n");
+    printf("\n");
+
+    printf("#ifdef MAPDATA_TABLES\n");
+    printf("\n");
+    printf("// how many links were added to each kind of map (its E in showMap())\n");
+    for (kind = 0; kind < NUM_MAP_KINDS; kind++) {
+        printf("#define %-24s %d\n", linkCounts[kind], maps[kind].nE);
+    }
+    printf("\n");
+    printf("// the connections of every kind of map, packed one place after\n");
+    printf("//  another and one kind after another (BASIC_MAP first); a place's\n");
+    printf("//  connections start at mapOffsets[kind][place] and end where the\n");
+    printf("//  next place's start\n");
+    printf("static const MapEdge mapEdges[] = {\n");
+    for (kind = 0; kind < NUM_MAP_KINDS; kind++) {
+        printf("    // %s\n", kindNames[kind]);
+        for (p = MIN_MAP_LOCATION; p <= MAX_MAP_LOCATION; p++) {
+            if (maps[kind].connections[p] == NULL) continue;
+            printf("    // %s\n", names[p]);
+            for (n = 0, curr = maps[kind].connections[p]; curr != NULL; curr = curr->next, n++) {
+                printf("%s{%s, %s},", (n % EDGES_A_LINE == 0) ? "    " : " ",
+                       names[curr->v], typeName(curr->type));
+                if (n % EDGES_A_LINE == EDGES_A_LINE - 1 || curr->next == NULL) printf("\n");
+            }
+        }
+    }
+    printf("};\n");
+    printf("\n");
+    printf("static const int mapOffsets[NUM_MAP_KINDS][NUM_MAP_LOCATIONS + 1] = {\n");
+    for (kind = 0; kind < NUM_MAP_KINDS; kind++) {
+        printf("    // %s\n", kindNames[kind]);
+        printf("    {");
+        for (p = MIN_MAP_LOCATION; p <= NUM_MAP_LOCATIONS; p++) {
+            if (p > MIN_MAP_LOCATION) printf((p % NUMS_A_LINE == 0) ? ",\n     " : ", ");
+            printf("%4d", offset);
+            if (p == NUM_MAP_LOCATIONS) break;
+            for (curr = maps[kind].connections[p]; curr != NULL; curr = curr->next) offset++;
+        }
+        printf("},\n");
+    }
+    printf("};\n");
+    printf("\n");
+    printf("// each place's type and how many places it is connected to by each\n");
+    printf("//  kind of transport\n");
+    printf("static const MapPlace mapPlaces[NUM_MAP_LOCATIONS] = {\n");
+    for (p = MIN_MAP_LOCATION; p <= MAX_MAP_LOCATION; p++) {
+        printf("    {%-5s %2d, %2d, %2d},    // %s\n",
+               (idToType(p) == SEA) ? "SEA," : "LAND,",
+               counts[p][ROAD], counts[p][RAIL], counts[p][BOAT], names[p]);
+    }
+    printf("};\n");
+    printf("\n");
+    printf("#endif\n");
+    printf("\n");
+
+    printf("#ifdef MAPDATA_MASKS\n");
+    printf("\n");
+    printf("// the places each place is connected to directly by ROAD, RAIL and BOAT\n");
+    printf("//  (in LocSet.h's layout: bit p %% 64 of word p / 64 is place p)\n");
+    printf("static const LocSet mapNeighbours[MAX_TRANSPORT + 1][NUM_MAP_LOCATIONS] = {\n");
+    for (type = MIN_TRANSPORT; type <= MAX_TRANSPORT; type++) {
+        printf("    [%s] = {\n", typeName(type));
+        for (p = MIN_MAP_LOCATION; p <= MAX_MAP_LOCATION; p++) {
+            printf("        {{0x%016llxULL, 0x%016llxULL}},    // %s\n",
+                   mask[type][p][0], mask[type][p][1], names[p]);
+        }
+        printf("    },\n");
+    }
+    printf("};\n");
+    printf("\n");
+    printf("#endif\n");
+    printf("\n");
+    printf("#endif\n");
+}
+
+int main(int argc, char *argv[]) {
+    char *path = (argc > 1) ? argv[1] : "../LABS/lab_w7/links.txt";
+
+    makeNames();
+    readLinks(path);
+    writeHeader(path);
+    return EXIT_SUCCESS;
+}
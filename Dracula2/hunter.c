@@ -30,6 +30,10 @@ void returnLastMessage(HunterView h, int player, char *message);
 #include "HunterView.h"
 #include "Places.h"
 #include "commonFunctions.h"
+#include "Distances.h"
+#include "HuntPlan.h"
+#include "hunter.h"
+#include "Trace.h"
 
 
 #include <time.h>
@@ -47,10 +51,19 @@ static int convergeOnLeader(HunterView h);
 //static int researchedBefore(HunterView h, LocationID *htrail);
 static int visitedDest(HunterView h, LocationID place, int pos);
 static LocationID searchNearby(HunterView h, int player);
+static LocationID chaseLikeliest(HunterView h, int player);
 LocationID *whereDracWent(HunterView h, int *numLocations, int *offset);
+static LocationID followPlan(HunterView h, HuntPlan *plan, int player,
+                             LocationID *targets, int nTargets);
 
 //static int leader = PLAYER_LORD_GODALMING; // Global leader variable
 
+// Plans made by the first hunter to move each round, which the rest of
+// them follow too if they are moved by the same program (until the next
+// game, see newHunterGame)
+static HuntPlan convergePlan;
+static HuntPlan chasePlan;
+
 /*
     Current Strategy:
         (1) Godalming starts in the centre of the map. Remaining players spread out LEFT, RIGHT, TOP.
@@ -66,6 +79,7 @@ LocationID *whereDracWent(HunterView h, int *numLocations, int *offset);
 
 void decideHunterMove(HunterView gameState)
 {  
+    TRACE_MOVE();
 
     srand(time(NULL));
     int player = whoAmI(gameState);         // store curr player
@@ -86,6 +100,7 @@ void decideHunterMove(HunterView gameState)
     /* Round 0 placement */
     if (round == 0) {
     
+        newHunterGame();
         submitID(startLocations[player],"Ready or not, here I come :D");  
 
     /* Low health, go to hospital */
@@ -126,15 +141,10 @@ void decideHunterMove(HunterView gameState)
             if (isFound == 0) {
                 //if (round % 4 == 0)
                 //    submitID(hTrail[0], "Researching!");
-                int steps = 0;
                 if (health <= 2)
                     submitID(hTrail[0],"Gotta heal up");
-                else if (!visitedDest(gameState,startLocations[player],TRAIL_SIZE))
-                    submitID(howToGetTo(startLocations[player],hTrail[0],round,player, &steps,0,1), "Can't find Drac, going home");
-                else if (!visitedDest(gameState,ROME,TRAIL_SIZE))
-                    submitID(howToGetTo(ROME,hTrail[0],round,player, &steps,0,1), "Can't find Drac, probs in that loop");
                 else
-                    submitID(searchNearby(gameState, player), "Searching Nearby");
+                    submitID(chaseLikeliest(gameState, player), "Can't see Drac, going where he probably is");
             } else {
                 if (dTrail[i] > MAX_MAP_LOCATION && dTrail[i] != TELEPORT) {
                       submitID(hTrail[0], "Temporary Fix");
@@ -191,24 +201,18 @@ LocationID convergeOnDrac(HunterView h) {
 
             LocationID *dracsChoices = whereDracWent(h,&numLocations,&offset);
 
-            if (numLocations == 1 && dracsChoices[0] != -1) {
-                dest = howToGetTo(dracsChoices[0],whereIs(h,player),round,player,&stepsAway,0,1);
-                free(dracsChoices);
-                return dest;
-            } else if (numLocations == 2 && dracsChoices[player%2] != -1) {
-
-                dest = howToGetTo(dracsChoices[player%2],whereIs(h,player),round,player,&stepsAway,0,1);
-                free(dracsChoices);
-                return dest;
-            } else if (numLocations == 3 && dracsChoices[player%3] != -1) {
-                dest = howToGetTo(dracsChoices[player%3],whereIs(h,player),round,player,&stepsAway,0,1);
-                free(dracsChoices);
-                return dest;
-            } else if (numLocations == 4 && dracsChoices[player%4] != -1) {
-                dest = howToGetTo(dracsChoices[player%4],whereIs(h,player),round,player,&stepsAway,0,1);
-                free(dracsChoices);
-                return dest;
-
+            // only a few places he can be, so split them between us
+            if (numLocations <= NUM_HUNTERS) {
+                LocationID choices[NUM_HUNTERS];
+                int numChoices = 0;
+                for (i = 0; i < numLocations; i++) {
+                    if (dracsChoices[i] != -1 && inArray(choices,dracsChoices[i],numChoices) == -1)
+                        choices[numChoices++] = dracsChoices[i];
+                }
+                if (numChoices > 0) {
+                    free(dracsChoices);
+                    return followPlan(h,&convergePlan,player,choices,numChoices);
+                }
             }
 
 
@@ -303,6 +307,52 @@ LocationID convergeOnLeader(HunterView h) {
     //Random trawling to places unvisited, if there is nothing to do        
 }
   
+// Forget the plans made in an earlier game, which could otherwise be
+// taken for this one's if it reaches the same round with the same trail
+void newHunterGame(void) {
+    memset(&convergePlan, 0, sizeof(convergePlan));
+    memset(&chasePlan, 0, sizeof(chasePlan));
+}
+
+// Head for one of the places Dracula is most likely to be at, the
+// hunters sharing out the likeliest few between them
+LocationID chaseLikeliest(HunterView h, int player) {
+
+    DracBelief belief;
+    LocationID likely[NUM_HUNTERS];
+    LocationID dTrail[TRAIL_SIZE];
+    int numLikely;
+
+    giveMeTheTrail(h,PLAYER_DRACULA,dTrail);
+    // already planned this round, so there are no targets to give
+    if (huntPlanIsCurrent(&chasePlan, giveMeTheRound(h), dTrail)) {
+        return followPlan(h, &chasePlan, player, NULL, 0);
+    }
+    whereMightDraculaBe(h, &belief);
+    numLikely = likeliestPlaces(&belief, likely, NUM_HUNTERS);
+    if (numLikely == 0) return searchNearby(h, player);
+    return followPlan(h, &chasePlan, player, likely, numLikely);
+}
+
+// The next move towards this hunter's place in the plan, making the plan
+// first from the targets unless it was already made for this round and
+// trail (so targets are only looked at when it has to be made)
+static LocationID followPlan(HunterView h, HuntPlan *plan, int player,
+                             LocationID *targets, int nTargets) {
+
+    LocationID dTrail[TRAIL_SIZE];
+    LocationID hunters[NUM_HUNTERS];
+    Round round = giveMeTheRound(h);
+    int hunter;
+
+    giveMeTheTrail(h,PLAYER_DRACULA,dTrail);
+    if (!huntPlanIsCurrent(plan, round, dTrail)) {
+        for (hunter = 0; hunter < NUM_HUNTERS; hunter++) hunters[hunter] = whereIs(h,hunter);
+        makeHuntPlan(plan, round, player, dTrail, hunters, targets, nTargets);
+    }
+    return shortestNextMove(whereIs(h,player), plan->target[player], player, round, BY_ANY);
+}
+
 // Search nearby for unvisited locations (ADJ TO STRASBOURG), returns -1 if nowhere to go         
 LocationID searchNearby(HunterView h, int player) {
 
@@ -313,7 +363,8 @@ LocationID searchNearby(HunterView h, int player) {
     int i = 0, j = 0; //int j = 0;   // uninitialised
     Round round = giveMeTheRound(h);
     //Don't want to wander around the sea
-    LocationID *placesToGo = whereCanIgo(h,&numPlaces,1,0,1);  // stores next possible location to go
+    LocationID placesToGo[NUM_MAP_LOCATIONS];                 // stores next possible location to go
+    numPlaces = fillWhereCanIgo(h,placesToGo,1,0,1);
     LocationID inCase = -1;                                    // value for no location found
 
     if (round < 6 && player == PLAYER_LORD_GODALMING) {
@@ -328,7 +379,6 @@ LocationID searchNearby(HunterView h, int player) {
                     if (inArray(placesNearDest,STRASBOURG,size)) {
                         free(placesNearDest);
                         int dest = placesToGo[i];
-                        free(placesToGo);
                         return dest;
                     }
                     free(placesNearDest);
@@ -342,7 +392,6 @@ LocationID searchNearby(HunterView h, int player) {
                 int visited = visitedDest(h,placesToGo[i],j);
                 if (!visited) {
                     int dest = placesToGo[i];       // if not visited and !Godalming
-                    free(placesToGo);
                     return dest;
                 }                                   // return location
             }
@@ -360,7 +409,6 @@ LocationID searchNearby(HunterView h, int player) {
     } else {
         inCase = placesToGo[0];
     }
-    free(placesToGo);
     return inCase;
 }
 
@@ -407,8 +455,8 @@ static LocationID *whereToGo(int player,int *numLocations, int from, int sea, in
 
     connections[0] = from;    //initialise the array
     Map map;
-    if (stationsAllowed > 0) map = newRailMap();
-    else map = newBasicMap();       //get the game map
+    if (stationsAllowed > 0) map = sharedMap(RAIL_MAP);
+    else map = sharedMap(BASIC_MAP);    //get the game map
     int i;
     
     //find the nearby cities of type ROAD
@@ -535,7 +583,7 @@ LocationID *whereDracWent(HunterView h, int *numLocations, int *offset) {
         return potentialLoc;
     }
 //Now starting to navigate the map to find potential Locs for drac
-    Map map = newBasicMap();
+    Map map = sharedMap(BASIC_MAP);
 
     LocationID *potentialLoc = malloc(sizeof(LocationID));
     potentialLoc = NearbyCities(map,lastLoc,potentialLoc,numLocations, ROAD);
@@ -5,3 +5,6 @@
 // Version: 1.0
 
 void decideHunterMove(HunterView gameState);
+
+// Forget everything kept from an earlier game (done at round 0 anyway)
+void newHunterGame(void);
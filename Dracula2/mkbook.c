@@ -0,0 +1,138 @@
+// mkbook.c ... work out Dracula's endgame table
+//
+// usage: ./mkbook [book file]       (dracBook.bin by default)
+//
+// The endgame table is for Dracula at 2 blood points or less, who has to
+// keep to land, against the two nearest hunters. Each turn he moves by
+// road (or stays put, as a hide or double back would) and then both
+// hunters move by road or sea or stay, and they catch him if either ends
+// up where he is. It is worked out backwards from where they catch him:
+// after pass k every entry is right up to k turns, and ENDGAME_TURNS
+// passes give the whole table. The trail and the hunters' rail moves are
+// left out, so it is a guide to which way to run rather than exact.
+//
+// See DracBook.h for the layout of the file.
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include "Globals.h"
+#include "Places.h"
+#include "Map.h"
+#include "LocSet.h"
+#include "DracBook.h"
+
+#define MOST_MOVES     NUM_MAP_LOCATIONS
+#define AT(d, a, b)    (((d) * NUM_MAP_LOCATIONS + (a)) * NUM_MAP_LOCATIONS + (b))
+
+//// The endgame
+
+// the places Dracula can keep to land on from d: by road, or staying
+//  put (the hospital is never one of them)
+static int dracMoves(LocationID d, LocationID moves[MOST_MOVES]) {
+    LocSet s = setUnion(neighbourSet(d, ROAD), neighbourSet(d, BOAT));
+    LocationID p;
+    int n = 0;
+
+    addToSet(&s, d);
+    while ((p = popFromSet(&s)) != NOWHERE) {
+        if (isLand(p) && p != ST_JOSEPH_AND_ST_MARYS) moves[n++] = p;
+    }
+    return n;
+}
+
+// the places a hunter can be at after one move from a (rail left out)
+static int hunterMoves(LocationID a, LocationID moves[MOST_MOVES]) {
+    LocSet s = setUnion(neighbourSet(a, ROAD), neighbourSet(a, BOAT));
+    LocationID p;
+    int n = 0;
+
+    addToSet(&s, a);
+    while ((p = popFromSet(&s)) != NOWHERE) moves[n++] = p;
+    return n;
+}
+
+static void makeEndgame(unsigned char *endgame) {
+    static LocationID dMoves[NUM_MAP_LOCATIONS][MOST_MOVES], hMoves[NUM_MAP_LOCATIONS][MOST_MOVES];
+    static int nDMoves[NUM_MAP_LOCATIONS], nHMoves[NUM_MAP_LOCATIONS];
+    unsigned char *best = malloc(BOOK_ENDGAME_SIZE);
+    LocationID d, a, b, to;
+    int pass, changed, i, j, v, worst;
+
+    assert(best != NULL);
+    for (d = MIN_MAP_LOCATION; d <= MAX_MAP_LOCATION; d++) {
+        nDMoves[d] = dracMoves(d, dMoves[d]);
+        nHMoves[d] = hunterMoves(d, hMoves[d]);
+    }
+    memset(endgame, 0, BOOK_ENDGAME_SIZE);
+    for (pass = 0, changed = 1; pass < ENDGAME_TURNS && changed; pass++) {
+        // best[d, a, b]: Dracula at d to move, the hunters just moved to
+        //  a and b; the most turns he has left by moving somewhere free
+        for (d = MIN_MAP_LOCATION; d <= MAX_MAP_LOCATION; d++) {
+            for (a = MIN_MAP_LOCATION; a <= MAX_MAP_LOCATION; a++) {
+                for (b = MIN_MAP_LOCATION; b <= MAX_MAP_LOCATION; b++) {
+                    v = 0;
+                    for (i = 0; i < nDMoves[d]; i++) {
+                        to = dMoves[d][i];
+                        if (to != a && to != b && endgame[AT(to, a, b)] > v) v = endgame[AT(to, a, b)];
+                    }
+                    best[AT(d, a, b)] = v;
+                }
+            }
+        }
+        // then the hunters at a and b move, catching him at d if either
+        //  gets there, and otherwise leaving him one turn more than best
+        changed = 0;
+        for (d = MIN_MAP_LOCATION; d <= MAX_MAP_LOCATION; d++) {
+            for (a = MIN_MAP_LOCATION; a <= MAX_MAP_LOCATION; a++) {
+                for (b = MIN_MAP_LOCATION; b <= MAX_MAP_LOCATION; b++) {
+                    worst = ENDGAME_TURNS;
+                    for (i = 0; i < nHMoves[a] && worst > 0; i++) {
+                        for (j = 0; j < nHMoves[b] && worst > 0; j++) {
+                            if (isLand(d) && (hMoves[a][i] == d || hMoves[b][j] == d)) {
+                                v = 0;
+                            } else {
+                                v = 1 + best[AT(d, hMoves[a][i], hMoves[b][j])];
+                            }
+                            if (v < worst) worst = v;
+                        }
+                    }
+                    if (endgame[AT(d, a, b)] != worst) changed = 1;
+                    endgame[AT(d, a, b)] = worst;
+                }
+            }
+        }
+    }
+    free(best);
+}
+
+int main(int argc, char *argv[]) {
+    char *path = (argc > 1) ? argv[1] : BOOK_FILE;
+    unsigned char *endgame = malloc(BOOK_ENDGAME_SIZE);
+    unsigned char key[BOOK_KEY_BYTES];
+    FILE *out;
+
+    if (argc > 2) {
+        fprintf(stderr, "usage: %s [book file]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    assert(endgame != NULL);
+    makeEndgame(endgame);
+    bookKeyBytes(key);
+
+    out = fopen(path, "wb");
+    if (out == NULL) {
+        perror(path);
+        return EXIT_FAILURE;
+    }
+    if (fwrite(BOOK_HEADER, 1, BOOK_HEADER_BYTES, out) != BOOK_HEADER_BYTES ||
+        fwrite(key, 1, BOOK_KEY_BYTES, out) != BOOK_KEY_BYTES ||
+        fwrite(endgame, 1, BOOK_ENDGAME_SIZE, out) != BOOK_ENDGAME_SIZE ||
+        fclose(out) != 0) {
+        perror(path);
+        return EXIT_FAILURE;
+    }
+    free(endgame);
+    return EXIT_SUCCESS;
+}
@@ -21,13 +21,27 @@
  * loop. Sort that out before you submit.
  *
  * Based on the program by David Collien, written in 2012
+ *
+ * Run with no arguments it plays one move for the game below. With -d it
+ * stays running and plays a move for each line read from stdin, and with
+ * -s path it does the same for each client connecting to a Unix socket
+ * at path, so the maps, distance tables and the view are only built once
+ * a game instead of once a move. Each line holds the plays made since the
+ * last line (the whole game so far for the first), and is answered with
+ * a "Move: ..." line just like the one printed below. A line "new" starts
+ * a new game, as does each new connection to the socket.
  */
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
 
 #include "Game.h"
+#include "Map.h"
 #ifdef I_AM_DRACULA
 #include "DracView.h"
 #include "dracula.h"
@@ -39,13 +53,33 @@
 // moves given by registerBestPlay are this long (including terminator)
 #define MOVE_SIZE 3
 
+// the most plays in a game, and the longest line a whole game needs
+#define MAX_PLAYS ((GAME_START_SCORE + 1) * NUM_PLAYERS)
+#define MAX_LINE (MAX_PLAYS * 8 + 2)
+
 // The minimum static globals I
 // can get away with
 static char latestPlay[MOVE_SIZE] = "";
 static char latestMessage[MESSAGE_SIZE] = "";
 
+static void serve(FILE *in, FILE *out);
+static int serveSocket(char *path);
+
 int main(int argc, char *argv[])
 {
+   if (argc == 2 && strcmp(argv[1], "-d") == 0) {
+      // the AIs print as they think, so that goes to stderr and only
+      // the moves to stdout
+      FILE *out = fdopen(dup(STDOUT_FILENO), "w");
+      dup2(STDERR_FILENO, STDOUT_FILENO);
+      serve(stdin, out);
+      return EXIT_SUCCESS;
+   }
+   if (argc == 3 && strcmp(argv[1], "-s") == 0) return serveSocket(argv[2]);
+   if (argc != 1) {
+      fprintf(stderr, "usage: %s [-d | -s socket path]\n", argv[0]);
+      return EXIT_FAILURE;
+   }
 #ifdef I_AM_DRACULA
    DracView gameState;
    //char *plays = "GGA.... SNP.... HSZ.... MLO....";
@@ -76,3 +110,96 @@ void registerBestPlay (char *play, PlayerMessage message) {
    strncpy(latestMessage, message, MESSAGE_SIZE);
    latestMessage[MESSAGE_SIZE-1] = '\0';
 }
+
+// The view the AI gets, and how to build, advance and answer it
+#ifdef I_AM_DRACULA
+typedef DracView View;
+static View newView(char *plays, PlayerMessage *msgs) { return newDracView(plays, msgs); }
+static void appendView(View v, char *plays, PlayerMessage *msgs) { appendDracPlays(v, plays, msgs); }
+static void decideMove(View v) { decideDraculaMove(v); }
+static void disposeView(View v) { disposeDracView(v); }
+static void newGame(void) { newDraculaGame(); }
+#else
+typedef HunterView View;
+static View newView(char *plays, PlayerMessage *msgs) { return newHunterView(plays, msgs); }
+static void appendView(View v, char *plays, PlayerMessage *msgs) { appendHunterPlays(v, plays, msgs); }
+static void decideMove(View v) { decideHunterMove(v); }
+static void disposeView(View v) { disposeHunterView(v); }
+static void newGame(void) { newHunterGame(); }
+#endif
+
+// Answers each line of plays from in with a move on out, until in ends
+// (a new game is started first, and again on each "new" line, so nothing
+// the AI kept is carried over from the last client or game)
+static void serve(FILE *in, FILE *out)
+{
+   static char line[MAX_LINE];
+   static PlayerMessage msgs[MAX_PLAYS];
+   View gameState = NULL;
+
+   newGame();
+   while (fgets(line, sizeof(line), in) != NULL) {
+      line[strcspn(line, "\r\n")] = '\0';
+      if (strcmp(line, "new") == 0) {
+         if (gameState != NULL) disposeView(gameState);
+         gameState = NULL;
+         newGame();
+         continue;
+      }
+      if (gameState == NULL) {
+         gameState = newView(line, msgs);
+      } else {
+         appendView(gameState, line, msgs);
+      }
+      latestPlay[0] = '\0';
+      latestMessage[0] = '\0';
+      decideMove(gameState);
+      fprintf(out, "Move: %s, Message: %s\n", latestPlay, latestMessage);
+      fflush(out);
+   }
+   if (gameState != NULL) disposeView(gameState);
+}
+
+// Serves one client at a time on a Unix socket at path, a game each
+static int serveSocket(char *path)
+{
+   struct sockaddr_un addr;
+   struct stat st;
+   FILE *in, *out;
+   int listener, client;
+
+   memset(&addr, 0, sizeof(addr));
+   addr.sun_family = AF_UNIX;
+   if (strlen(path) >= sizeof(addr.sun_path)) {
+      fprintf(stderr, "%s: socket path too long\n", path);
+      return EXIT_FAILURE;
+   }
+   strcpy(addr.sun_path, path);
+   // a socket left by an earlier run is replaced, but nothing else is
+   if (lstat(path, &st) == 0) {
+      if (!S_ISSOCK(st.st_mode)) {
+         fprintf(stderr, "%s: exists and is not a socket\n", path);
+         return EXIT_FAILURE;
+      }
+      unlink(path);
+   }
+   listener = socket(AF_UNIX, SOCK_STREAM, 0);
+   if (listener < 0 || bind(listener, (struct sockaddr *)&addr, sizeof(addr)) < 0 ||
+       listen(listener, 1) < 0) {
+      perror(path);
+      return EXIT_FAILURE;
+   }
+   while ((client = accept(listener, NULL, NULL)) >= 0) {
+      in = fdopen(client, "r");
+      out = fdopen(dup(client), "w");
+      if (in == NULL || out == NULL) {
+         perror("client");
+         return EXIT_FAILURE;
+      }
+      serve(in, out);
+      fclose(in);
+      fclose(out);
+   }
+   perror("accept");
+   return EXIT_FAILURE;
+}
@@ -0,0 +1,457 @@
+// selfplay.c ... a headless referee for playing the AIs against each other
+//
+// Plays whole games between decideDraculaMove() and decideHunterMove()
+// without the real game engine. Each turn the player to move gets a view
+// of the game so far (the hunters only see where Dracula was if the rules
+// let them), the move it registers is checked against the rules and then
+// played out on a GameState, which keeps health, score, traps and
+// vampires. An illegal move (or no move at all) is counted and replaced by
+// a legal one so the game can go on.
+//
+// Games are shared out between worker processes, one per core by default,
+// so the AIs' globals can't get in each other's way. Each game has a seed,
+// and the hunters (which seed rand() from time()) are given a clock made
+// from it, so a game played again with the same seed and a search time of
+// 0 goes the same way.
+//
+// usage: ./selfplay [-n games] [-j jobs] [-s first seed] [-t search ms] [-v]
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "Game.h"
+#include "Globals.h"
+#include "Places.h"
+#include "Map.h"
+#include "GameView.h"
+#include "GameState.h"
+#include "LocSet.h"
+
+// the AIs, each linked with its own view (see dracAI.o and hunterAI.o in
+//  the Makefile), so their headers can't both be included here
+typedef struct dracView *DracView;
+typedef struct hunterView *HunterView;
+DracView newDracView(char *pastPlays, PlayerMessage messages[]);
+void disposeDracView(DracView toBeDeleted);
+void decideDraculaMove(DracView gameState);
+void setDraculaSearchTime(int milliseconds);
+void setDraculaSearchThreads(int threads);
+HunterView newHunterView(char *pastPlays, PlayerMessage messages[]);
+void disposeHunterView(HunterView toBeDeleted);
+void decideHunterMove(HunterView gameState);
+
+#define PLAY_SIZE          8      // "GLO.... " including the space
+#define MAX_TURNS          ((GAME_START_SCORE + 1) * NUM_PLAYERS)
+#define MAX_PLAYS_SIZE     (MAX_TURNS * PLAY_SIZE + 1)
+#define LATENCY_BUCKETS    32     // bucket i counts moves under 2^i microseconds
+#define DRACULA_SIDE       0
+#define HUNTER_SIDE        1
+
+// how long one side took to decide its moves
+typedef struct moveTimes {
+    long moves;
+    double totalMs;
+    double maxMs;
+    long bucket[LATENCY_BUCKETS];
+} MoveTimes;
+
+// what a worker sends back about one game
+typedef struct gameResult {
+    int seed;
+    int dracWon;
+    int score;
+    int rounds;
+    int dracHealth;
+    int illegal[2];               // illegal moves by Dracula and by the hunters
+    MoveTimes times[2];
+} GameResult;
+
+// one game in progress
+typedef struct match {
+    GameState state;
+    char plays[MAX_PLAYS_SIZE];           // everything, as Dracula sees it
+    char hunterPlays[MAX_PLAYS_SIZE];     // Dracula's moves hidden where need be
+    PlayerMessage messages[MAX_TURNS];
+    int turns;
+    int dracTurn[TRAIL_SIZE];             // the turns that made up the trail
+} Match;
+
+static char latestPlay[3];
+static time_t gameClock;
+
+// the move the AI deciding now has registered
+void registerBestPlay(char *play, PlayerMessage message) {
+    strncpy(latestPlay, play, 2);
+    latestPlay[2] = '\0';
+    (void)message;
+}
+
+// the hunters seed rand() with time(NULL), so the program is linked with
+//  --wrap=time and they get a clock that only the game's seed moves on
+time_t __wrap_time(time_t *t) {
+    if (t != NULL) *t = gameClock;
+    return gameClock;
+}
+
+// milliseconds between two clock readings
+static double msBetween(struct timespec *from, struct timespec *to) {
+    return (to->tv_sec - from->tv_sec) * 1000.0 +
+           (to->tv_nsec - from->tv_nsec) / 1000000.0;
+}
+
+static void addTime(MoveTimes *times, double ms) {
+    int b = 0;
+    times->moves++;
+    times->totalMs += ms;
+    if (ms > times->maxMs) times->maxMs = ms;
+    while (b < LATENCY_BUCKETS - 1 && ms * 1000 >= (1L << b)) b++;
+    times->bucket[b]++;
+}
+
+// what Dracula's move means, or NOWHERE if it isn't one
+static LocationID parseDracMove(char *play) {
+    if (strcmp(play, "HI") == 0) return HIDE;
+    if (strcmp(play, "TP") == 0) return TELEPORT;
+    if (play[0] == 'D' && play[1] >= '1' && play[1] <= '5' && play[2] == '\0') {
+        return DOUBLE_BACK_1 + play[1] - '1';
+    }
+    return abbrevToID(play);
+}
+
+static void moveToAbbrev(LocationID move, char abbrev[3]) {
+    if (move == HIDE) {
+        strcpy(abbrev, "HI");
+    } else if (move == TELEPORT) {
+        strcpy(abbrev, "TP");
+    } else if (move >= DOUBLE_BACK_1 && move <= DOUBLE_BACK_5) {
+        abbrev[0] = 'D';
+        abbrev[1] = '1' + move - DOUBLE_BACK_1;
+        abbrev[2] = '\0';
+    } else {
+        idToAbbrev(move, abbrev);
+    }
+}
+
+// is move one Dracula may make in state
+// he can't go back to a place in the trail he will be leaving, can hide
+//  (not at sea) and double back once each while they're in the trail,
+//  and is teleported to his castle only when there is nothing else
+static int dracMoveIsLegal(GameState *state, LocationID move, int canMove) {
+    LocationID from = state->trail[0];
+    int i;
+
+    if (from == NOWHERE) {
+        return validPlace(move) && move != ST_JOSEPH_AND_ST_MARYS;
+    }
+    LocSet adjacent = movesFromSet(from, PLAYER_DRACULA, state->round, TRUE, FALSE, TRUE);
+    if (move == TELEPORT) return !canMove;
+    if (move == HIDE) {
+        if (isSea(from)) return FALSE;
+        for (i = 0; i < TRAIL_SIZE - 1; i++) {
+            if (state->moves[i] == HIDE) return FALSE;
+        }
+        return TRUE;
+    }
+    if (move >= DOUBLE_BACK_1 && move <= DOUBLE_BACK_5) {
+        LocationID to = state->trail[move - DOUBLE_BACK_1];
+        if (!validPlace(to) || !inSet(adjacent, to)) return FALSE;
+        for (i = 0; i < TRAIL_SIZE - 1; i++) {
+            if (state->moves[i] >= DOUBLE_BACK_1 && state->moves[i] <= DOUBLE_BACK_5) {
+                return FALSE;
+            }
+        }
+        return TRUE;
+    }
+    if (!validPlace(move) || move == from || !inSet(adjacent, move)) return FALSE;
+    for (i = 0; i < TRAIL_SIZE - 1; i++) {
+        if (state->trail[i] == move) return FALSE;
+    }
+    return TRUE;
+}
+
+// the first legal move Dracula has, or TELEPORT
+static LocationID firstDracMove(GameState *state) {
+    LocationID move;
+    for (move = MIN_MAP_LOCATION; move <= DOUBLE_BACK_5; move++) {
+        if (move > MAX_MAP_LOCATION && move < HIDE) continue;
+        if (dracMoveIsLegal(state, move, TRUE)) return move;
+    }
+    return TELEPORT;
+}
+
+static int hunterMoveIsLegal(GameState *state, LocationID move) {
+    LocationID from = state->location[(int)state->player];
+    if (!validPlace(move)) return FALSE;
+    if (from == NOWHERE) return TRUE;
+    return inSet(movesFromSet(from, state->player, state->round, TRUE, TRUE, TRUE), move);
+}
+
+// show the hunters where Dracula really was at turn
+static void reveal(Match *m, int turn) {
+    memcpy(&m->hunterPlays[turn * PLAY_SIZE + 1], &m->plays[turn * PLAY_SIZE + 1], 2);
+}
+
+// add a play to both pastPlays strings
+static void addPlay(Match *m, char play[PLAY_SIZE]) {
+    int at = m->turns * PLAY_SIZE;
+    if (m->turns > 0) {
+        m->plays[at - 1] = ' ';
+        m->hunterPlays[at - 1] = ' ';
+    }
+    memcpy(&m->plays[at], play, PLAY_SIZE);
+    memcpy(&m->hunterPlays[at], play, PLAY_SIZE);
+    m->messages[m->turns][0] = '\0';
+    m->turns++;
+}
+
+// play Dracula's move, writing what happened into play
+static void playDracula(Match *m, LocationID move, char play[PLAY_SIZE]) {
+    GameState *state = &m->state;
+    MoveUndo undo;
+    PlayerID hunter;
+    unsigned char leaving = state->minions[TRAIL_SIZE - 1];
+    int turn = m->turns, i;
+
+    memcpy(play, "D......", PLAY_SIZE);
+    moveToAbbrev(move, &play[1]);
+    play[3] = '.';
+    applyMove(state, move, &undo);
+    if (state->minions[0] & TRAP_HERE) play[3] = 'T';
+    if (state->minions[0] & VAMPIRE_HERE) play[4] = 'V';
+    if (leaving & VAMPIRE_HERE) play[5] = 'V';
+    else if (leaving & TRAP_HERE) play[5] = 'M';
+    addPlay(m, play);
+
+    for (i = TRAIL_SIZE - 1; i > 0; i--) m->dracTurn[i] = m->dracTurn[i - 1];
+    m->dracTurn[0] = turn;
+    if (validPlace(move)) {
+        // the hunters see his castle, and him if he lands on one of them
+        int seen = (move == CASTLE_DRACULA);
+        for (hunter = PLAYER_LORD_GODALMING; hunter < PLAYER_DRACULA; hunter++) {
+            if (state->location[hunter] == move) seen = TRUE;
+        }
+        if (!seen) {
+            memcpy(&m->hunterPlays[turn * PLAY_SIZE + 1], isSea(move) ? "S?" : "C?", 2);
+        }
+    }
+}
+
+// play a hunter's move, writing what happened into play
+static void playHunter(Match *m, LocationID move, char play[PLAY_SIZE]) {
+    GameState *state = &m->state;
+    PlayerID hunter = state->player;
+    MoveUndo undo;
+    int n = 3, i;
+
+    memcpy(play, "G......", PLAY_SIZE);
+    play[0] = "GSHM"[hunter];
+    idToAbbrev(move, &play[1]);
+    play[3] = '.';
+    for (i = 0; i < TRAIL_SIZE && n < PLAY_SIZE - 1; i++) {
+        if (state->trail[i] == move && (state->minions[i] & TRAP_HERE)) play[n++] = 'T';
+    }
+    for (i = 0; i < TRAIL_SIZE && n < PLAY_SIZE - 1; i++) {
+        if (state->trail[i] == move && (state->minions[i] & VAMPIRE_HERE)) play[n++] = 'V';
+    }
+    if (n < PLAY_SIZE - 1 && move == state->location[PLAYER_DRACULA] && !isSea(move)) {
+        play[n++] = 'D';
+    }
+    applyMove(state, move, &undo);
+    addPlay(m, play);
+
+    // a hunter going through a place in the trail shows that it was there
+    for (i = 0; i < TRAIL_SIZE; i++) {
+        if (state->trail[i] == move && m->dracTurn[i] >= 0) reveal(m, m->dracTurn[i]);
+    }
+}
+
+// ask the player to move for its move and play it
+static void playTurn(Match *m, GameResult *result) {
+    GameState *state = &m->state;
+    struct timespec start, end;
+    LocationID move;
+    char play[PLAY_SIZE];
+    int side = (state->player == PLAYER_DRACULA) ? DRACULA_SIDE : HUNTER_SIDE;
+
+    gameClock = (time_t)result->seed * MAX_TURNS + m->turns;
+    latestPlay[0] = '\0';
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    if (side == DRACULA_SIDE) {
+        DracView view = newDracView(m->plays, m->messages);
+        decideDraculaMove(view);
+        disposeDracView(view);
+    } else {
+        HunterView view = newHunterView(m->hunterPlays, m->messages);
+        decideHunterMove(view);
+        disposeHunterView(view);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    addTime(&result->times[side], msBetween(&start, &end));
+
+    if (side == DRACULA_SIDE) {
+        move = parseDracMove(latestPlay);
+        int canMove = (firstDracMove(state) != TELEPORT);
+        if (!dracMoveIsLegal(state, move, canMove)) {
+            result->illegal[side]++;
+            move = firstDracMove(state);
+        }
+        playDracula(m, move, play);
+    } else {
+        move = abbrevToID(latestPlay);
+        if (!hunterMoveIsLegal(state, move)) {
+            result->illegal[side]++;
+            move = state->location[(int)state->player];
+            if (move == NOWHERE) move = ST_JOSEPH_AND_ST_MARYS;
+        }
+        playHunter(m, move, play);
+    }
+}
+
+static void playGame(int seed, GameResult *result) {
+    static Match m;
+    PlayerMessage none[1] = { "" };
+    GameView start = newGameView("", none);
+    int i;
+
+    memset(result, 0, sizeof(GameResult));
+    result->seed = seed;
+    memset(&m, 0, sizeof(m));
+    viewToState(start, &m.state);
+    disposeGameView(start);
+    for (i = 0; i < TRAIL_SIZE; i++) m.dracTurn[i] = -1;
+
+    while (m.turns < MAX_TURNS) {
+        playTurn(&m, result);
+        if (m.state.health[PLAYER_DRACULA] <= 0 || m.state.score <= 0) break;
+    }
+    result->dracWon = (m.state.health[PLAYER_DRACULA] > 0);
+    result->score = m.state.score;
+    result->rounds = m.state.round;
+    result->dracHealth = m.state.health[PLAYER_DRACULA];
+}
+
+// play games first, first + jobs ... writing the results to out
+static void worker(int first, int numGames, int jobs, int seed, FILE *out) {
+    GameResult result;
+    int game;
+
+    for (game = first; game < numGames; game += jobs) {
+        playGame(seed + game, &result);
+        fwrite(&result, sizeof(result), 1, out);
+        fflush(out);
+    }
+}
+
+// the time under which fraction of the moves were decided, to a power of two
+static double percentileMs(MoveTimes *times, double fraction) {
+    long seen = 0;
+    int b;
+    for (b = 0; b < LATENCY_BUCKETS; b++) {
+        seen += times->bucket[b];
+        if (seen >= fraction * times->moves) break;
+    }
+    return (1L << b) / 1000.0;
+}
+
+static void addResult(GameResult *total, GameResult *r) {
+    int side, b;
+    total->dracWon += r->dracWon;
+    total->score += r->score;
+    total->rounds += r->rounds;
+    for (side = DRACULA_SIDE; side <= HUNTER_SIDE; side++) {
+        total->illegal[side] += r->illegal[side];
+        total->times[side].moves += r->times[side].moves;
+        total->times[side].totalMs += r->times[side].totalMs;
+        if (r->times[side].maxMs > total->times[side].maxMs) {
+            total->times[side].maxMs = r->times[side].maxMs;
+        }
+        for (b = 0; b < LATENCY_BUCKETS; b++) {
+            total->times[side].bucket[b] += r->times[side].bucket[b];
+        }
+    }
+}
+
+static void showTimes(char *name, MoveTimes *times) {
+    if (times->moves == 0) return;
+    printf("%-8s %7ld moves, mean %.2f ms, p50 < %.3f ms, p95 < %.3f ms, max %.2f ms\n",
+           name, times->moves, times->totalMs / times->moves,
+           percentileMs(times, 0.5), percentileMs(times, 0.95), times->maxMs);
+}
+
+int main(int argc, char *argv[]) {
+    int numGames = 100, jobs = 0, seed = 1, verbose = FALSE;
+    int searchMs = -1, played = 0, job, opt;
+    int pipeEnds[2];
+    GameResult result, total;
+    FILE *in;
+
+    while ((opt = getopt(argc, argv, "n:j:s:t:v")) != -1) {
+        switch (opt) {
+            case 'n': numGames = atoi(optarg); break;
+            case 'j': jobs = atoi(optarg); break;
+            case 's': seed = atoi(optarg); break;
+            case 't': searchMs = atoi(optarg); break;
+            case 'v': verbose = TRUE; break;
+            default:
+                fprintf(stderr, "usage: %s [-n games] [-j jobs] [-s seed] [-t search ms] [-v]\n",
+                        argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+    if (jobs <= 0) jobs = sysconf(_SC_NPROCESSORS_ONLN);
+    if (jobs > numGames) jobs = numGames;
+    if (jobs < 1) jobs = 1;
+
+    int err = pipe(pipeEnds);
+    assert(err == 0);
+    fflush(stdout);
+    for (job = 0; job < jobs; job++) {
+        pid_t pid = fork();
+        assert(pid >= 0);
+        if (pid == 0) {
+            // the AIs talk a lot, and each worker is already one core's worth
+            close(pipeEnds[0]);
+            if (freopen("/dev/null", "w", stdout) == NULL) return EXIT_FAILURE;
+            if (searchMs >= 0) setDraculaSearchTime(searchMs);
+            setDraculaSearchThreads(1);
+            worker(job, numGames, jobs, seed, fdopen(pipeEnds[1], "w"));
+            exit(EXIT_SUCCESS);
+        }
+    }
+    close(pipeEnds[1]);
+
+    memset(&total, 0, sizeof(total));
+    in = fdopen(pipeEnds[0], "r");
+    while (fread(&result, sizeof(result), 1, in) == 1) {
+        if (verbose) {
+            printf("seed %d: %s won, score %d, round %d, Dracula's blood %d, illegal %d/%d\n",
+                   result.seed, result.dracWon ? "Dracula" : "hunters", result.score,
+                   result.rounds, result.dracHealth, result.illegal[DRACULA_SIDE],
+                   result.illegal[HUNTER_SIDE]);
+        }
+        addResult(&total, &result);
+        played++;
+    }
+    fclose(in);
+    while (wait(NULL) > 0);
+
+    if (played == 0) {
+        printf("no games finished\n");
+        return EXIT_FAILURE;
+    }
+    printf("%d games (%d jobs, seeds %d-%d)\n", played, jobs, seed, seed + numGames - 1);
+    printf("Dracula won %d (%.1f%%), hunters won %d (%.1f%%)\n",
+           total.dracWon, 100.0 * total.dracWon / played,
+           played - total.dracWon, 100.0 * (played - total.dracWon) / played);
+    printf("mean final score %.1f, mean rounds %.1f\n",
+           (double)total.score / played, (double)total.rounds / played);
+    printf("illegal moves: Dracula %d, hunters %d\n",
+           total.illegal[DRACULA_SIDE], total.illegal[HUNTER_SIDE]);
+    showTimes("Dracula", &total.times[DRACULA_SIDE]);
+    showTimes("hunters", &total.times[HUNTER_SIDE]);
+    return (played == numGames) ? EXIT_SUCCESS : EXIT_FAILURE;
+}